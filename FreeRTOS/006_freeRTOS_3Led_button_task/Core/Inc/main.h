@@ -53,7 +53,7 @@ extern "C" {
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
-
+void led_tasks_create(void);
 /* USER CODE END EFP */
 
 /* Private defines -----------------------------------------------------------*/
@@ -0,0 +1,249 @@
+/*
+ * led_tasks.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Rahul B.
+ *
+ *  The LED notification chain: LED1..LED3 blink until the button task
+ *  notifies them, one per press, in turn; each notified LED task switches
+ *  its LED off and hands next_task_handle on. Kept out of main.c so the
+ *  host simulation (FreeRTOS/sim) builds the same tasks.
+ */
+
+#include "main.h"
+#include <stdio.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+static void led1_task1_handler(void *Parameters);
+static void led2_task2_handler(void *Parameters);
+static void led3_task3_handler(void *Parameters);
+static void button_task4_handler(void *Parameters);
+
+TaskHandle_t led1_task1_handle;
+TaskHandle_t led2_task2_handle;
+TaskHandle_t led3_task3_handle;
+TaskHandle_t button_task4_handle;
+
+TaskHandle_t volatile next_task_handle= NULL;
+
+/* Creates the four tasks; the scheduler is started by the caller */
+void led_tasks_create(void)
+{
+    BaseType_t status;
+
+    printf("\r\n=== SYSTEM STARTING ===\r\n");
+
+    status = xTaskCreate(led1_task1_handler, "Task-1", 200, NULL, 1, &led1_task1_handle);
+    configASSERT(status == pdPASS);
+    printf("LED1 Task created, handle: %p\r\n", led1_task1_handle);
+
+    next_task_handle = led1_task1_handle;
+    printf("next_task_handle initialized to: %p\r\n", next_task_handle);
+
+    status = xTaskCreate(led2_task2_handler, "Task-2", 200, NULL, 2, &led2_task2_handle);
+    configASSERT(status == pdPASS);
+    printf("LED2 Task created, handle: %p\r\n", led2_task2_handle);
+
+    status = xTaskCreate(led3_task3_handler, "Task-3", 200, NULL, 3, &led3_task3_handle);
+    configASSERT(status == pdPASS);
+    printf("LED3 Task created, handle: %p\r\n", led3_task3_handle);
+
+    status = xTaskCreate(button_task4_handler, "Button Task-4", 200, NULL, 4, &button_task4_handle);
+    configASSERT(status == pdPASS);
+    printf("Button Task created, handle: %p\r\n", button_task4_handle);
+
+    printf("All tasks created successfully\r\n");
+    printf("Starting FreeRTOS scheduler...\r\n");
+}
+
+static void led1_task1_handler(void *Parameters)
+{
+    BaseType_t status;
+    printf("=== LED1 Task Started ===\r\n");
+
+    while(1)
+    {
+        printf("LED1: Toggling led1 (PA5)\r\n");
+        HAL_GPIO_TogglePin(GPIOA, GPIO_PIN_5);
+
+        printf("LED1: Waiting for notification (timeout: 2000ms)...\r\n");
+        status = xTaskNotifyWait(0, 0, NULL, pdMS_TO_TICKS(2000));
+
+        if(status == pdTRUE)
+        {
+            printf("LED1: *** NOTIFICATION RECEIVED! ***\r\n");
+            vTaskSuspendAll();
+            next_task_handle = led2_task2_handle;
+            printf("LED1: next_task_handle changed to LED2: %p\r\n", next_task_handle);
+            xTaskResumeAll();
+            HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_RESET);
+            printf("LED1: LED turned OFF, deleting task1\r\n");
+            vTaskDelete(NULL);
+        }
+        else
+        {
+            printf("LED1: Timeout - no notification received\r\n");
+        }
+    }
+}
+
+static void led2_task2_handler(void *Parameters)
+{
+    BaseType_t status;
+    printf("=== LED2 Task Started ===\r\n");
+
+    while(1)
+    {
+        printf("LED2: Toggling led2 (PA6)\r\n");
+        HAL_GPIO_TogglePin(GPIOA, GPIO_PIN_6);
+
+        printf("LED2: Waiting for notification (timeout: 1500ms)...\r\n");
+        status = xTaskNotifyWait(0, 0, NULL, pdMS_TO_TICKS(1500));
+
+        if(status == pdTRUE)
+        {
+            printf("LED2: *** NOTIFICATION RECEIVED! ***\r\n");
+            vTaskSuspendAll();
+            next_task_handle = led3_task3_handle;
+            printf("LED2: next_task_handle changed to LED3: %p\r\n", next_task_handle);
+            xTaskResumeAll();
+            HAL_GPIO_WritePin(GPIOA, GPIO_PIN_6, GPIO_PIN_RESET);
+            printf("LED2: LED turned OFF, deleting task2\r\n");
+            vTaskDelete(NULL);
+        }
+        else
+        {
+            printf("LED2: Timeout - no notification received\r\n");
+        }
+    }
+}
+
+static void led3_task3_handler(void *Parameters)
+{
+    BaseType_t status;
+    printf("=== LED3 Task Started ===\r\n");
+
+    while(1)
+    {
+        printf("LED3: Toggling led3 (PA4)\r\n");
+        HAL_GPIO_TogglePin(GPIOA, GPIO_PIN_4);
+
+        printf("LED3: Waiting for notification (timeout: 1000ms)...\r\n");
+        status = xTaskNotifyWait(0, 0, NULL, pdMS_TO_TICKS(1000));
+
+        if(status == pdTRUE)
+        {
+            printf("LED3: *** NOTIFICATION RECEIVED! ***\r\n");
+            vTaskSuspendAll();
+            next_task_handle = NULL;
+            printf("LED3: next_task_handle set to NULL\r\n");
+            xTaskResumeAll();
+            HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_RESET);
+            printf("LED3: LED turned OFF\r\n");
+            printf("LED3: Deleting button task (%p)\r\n", button_task4_handle);
+            vTaskDelete(button_task4_handle);
+            printf("LED3: Deleting LED3 task (self)\r\n");
+            vTaskDelete(NULL);
+        }
+        else
+        {
+            printf("LED3: Timeout - no notification received\r\n");
+        }
+    }
+}
+
+static void button_task4_handler(void *Parameters)
+{
+    uint8_t btn_read = 0;
+    uint8_t prev_read = 0;
+    static uint32_t button_press_count = 0;
+    static uint32_t debug_counter = 0;
+
+    printf("=== BUTTON Task Started ===\r\n");
+    printf("BUTTON: Current next_task_handle: %p\r\n", next_task_handle);
+
+    // Print pin definitions for debugging
+    printf("BUTTON: B1_Pin = 0x%04X, B1_GPIO_Port = %p\r\n", (uint16_t)B1_Pin, B1_GPIO_Port);
+
+    // Initialize previous state - USING CORRECT PIN!
+    prev_read = HAL_GPIO_ReadPin(B1_GPIO_Port, B1_Pin);
+    printf("BUTTON: Initial button state (B1_Pin): %d\r\n", prev_read);
+
+    // Also check PA0 for comparison
+    uint8_t pa0_state = HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_0);
+    printf("BUTTON: Initial PA0 state: %d\r\n", pa0_state);
+
+    while(1)
+    {
+        // Read the CORRECT button pin - B1_Pin, not GPIO_PIN_0!
+        btn_read = HAL_GPIO_ReadPin(B1_GPIO_Port, B1_Pin);
+
+        debug_counter++;
+
+        // Print button state every 100 cycles for debugging
+        if(debug_counter % 100 == 0)
+        {
+            printf("BUTTON: Debug #%lu - B1_Pin: %d, PA0: %d, next_task: %p\r\n",
+                   debug_counter/100, btn_read, HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_0), next_task_handle);
+        }
+
+        // Print any button state changes immediately
+        if(btn_read != prev_read)
+        {
+            printf("BUTTON: *** STATE CHANGE #%lu *** %d -> %d\r\n", ++button_press_count, prev_read, btn_read);
+        }
+
+        // For STM32 Nucleo, button is typically:
+        // - HIGH when not pressed (with pull-up)
+        // - LOW when pressed
+        // So we detect HIGH to LOW (falling edge) for button press
+
+        if(!btn_read && prev_read)  // Falling edge: button pressed
+        {
+            printf("BUTTON: *** BUTTON PRESSED *** (Falling Edge Detection)\r\n");
+
+            // Debounce delay
+            vTaskDelay(pdMS_TO_TICKS(50));
+
+            // Re-read to confirm
+            btn_read = HAL_GPIO_ReadPin(B1_GPIO_Port, B1_Pin);
+            printf("BUTTON: After debounce, button state: %d\r\n", btn_read);
+
+            if(!btn_read) // Still pressed after debounce
+            {
+                printf("BUTTON: Button press confirmed, current next_task_handle: %p\r\n", next_task_handle);
+
+                if(next_task_handle != NULL)
+                {
+                    printf("BUTTON: Sending notification to task %p\r\n", next_task_handle);
+                    BaseType_t notify_result = xTaskNotify(next_task_handle, 0, eNoAction);
+
+                    if(notify_result == pdPASS)
+                    {
+                        printf("BUTTON: *** NOTIFICATION SENT SUCCESSFULLY ***\r\n");
+                    }
+                    else
+                    {
+                        printf("BUTTON: *** NOTIFICATION FAILED ***\r\n");
+                    }
+                }
+                else
+                {
+                    printf("BUTTON: next_task_handle is NULL - no task to notify\r\n");
+                }
+
+                // Wait for button release
+                printf("BUTTON: Waiting for button release...\r\n");
+                while(!HAL_GPIO_ReadPin(B1_GPIO_Port, B1_Pin))
+                {
+                    vTaskDelay(pdMS_TO_TICKS(10));
+                }
+                printf("BUTTON: Button released\r\n");
+            }
+        }
+
+        prev_read = btn_read;
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
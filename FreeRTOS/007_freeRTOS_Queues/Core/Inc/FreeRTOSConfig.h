@@ -45,16 +45,20 @@
 #if defined( __ICCARM__) || defined(__GNUC__) || defined(__CC_ARM)
 	#include <stdint.h>
 	extern uint32_t SystemCoreClock;
+	void profiler_timer_init(void);
+	extern volatile uint32_t profiler_switches[];
 #endif
 
 #define configUSE_PREEMPTION			1
 #define configUSE_IDLE_HOOK				0
 #define configUSE_TICK_HOOK				0
+/* 2: vPortSuppressTicksAndSleep() comes from power_tickless.c */
+#define configUSE_TICKLESS_IDLE			2
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP	2
 #define configCPU_CLOCK_HZ				( SystemCoreClock )
 #define configTICK_RATE_HZ				( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES			( 5 )
 #define configMINIMAL_STACK_SIZE		( ( unsigned short ) 130 )
-#define configTOTAL_HEAP_SIZE			( ( size_t ) ( 75  * 1024 ) )
 #define configMAX_TASK_NAME_LEN			( 10 )
 #define configUSE_TRACE_FACILITY		1
 #define configUSE_16_BIT_TICKS			0
@@ -66,7 +70,20 @@
 #define configUSE_MALLOC_FAILED_HOOK	0
 #define configUSE_APPLICATION_TASK_TAG	0
 #define configUSE_COUNTING_SEMAPHORES	1
-#define configGENERATE_RUN_TIME_STATS	0
+#define configGENERATE_RUN_TIME_STATS	1
+
+/* Memory allocation: every object is static (see app_objects.h), no heap. */
+#define configSUPPORT_STATIC_ALLOCATION		1
+#define configSUPPORT_DYNAMIC_ALLOCATION	0
+#define configKERNEL_PROVIDED_STATIC_MEMORY	1
+
+/* Run-time statistics for the profiler task (profiler.c): run time in CPU
+cycles from the DWT cycle counter, switch-ins counted per task number.
+Tickless sleep adds the cycles the counter missed (power_tickless.c). */
+#define PROFILER_MAX_TASKS				16	/* power of two */
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()	profiler_timer_init()
+#define portGET_RUN_TIME_COUNTER_VALUE()	( *( volatile uint32_t * ) 0xE0001004UL )	/* DWT->CYCCNT */
+#define traceTASK_SWITCHED_IN()	profiler_switches[ pxCurrentTCB->uxTCBNumber & ( PROFILER_MAX_TASKS - 1 ) ]++
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES 		0
@@ -90,6 +107,7 @@ to exclude the API function. */
 
 #define INCLUDE_xTaskGetIdleTaskHandle  1
 #define INCLUDE_pxTaskGetStackStart		1
+#define INCLUDE_uxTaskGetStackHighWaterMark	1
 
 /* Cortex-M specific definitions. */
 #ifdef __NVIC_PRIO_BITS
@@ -0,0 +1,56 @@
+/*
+ * app_objects.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Rahul B.
+ *
+ *  Every kernel object of the app, sized at compile time. rtos_objects.c
+ *  turns these tables into static storage; there is no FreeRTOS heap
+ *  (configSUPPORT_DYNAMIC_ALLOCATION is 0), so an oversized table shows
+ *  up as a RAM overflow at link time.
+ */
+
+#ifndef APP_OBJECTS_H_
+#define APP_OBJECTS_H_
+
+#include "main.h"
+
+#define TASK_STACK_WORDS	250
+/*
+ * configMAX_PRIORITIES is 5, so valid priorities are 0..4. The tasks used to
+ * be created at 5, which trips configASSERT(uxPriority < configMAX_PRIORITIES)
+ * in xTaskCreateStatic(). They now sit at 3, one below the profiler, so the
+ * profiler preempts them and still samples while one of them spins.
+ */
+#define TASK_PRIORITY		3
+#define PROFILER_PRIORITY	4	/* runs for a moment every period, even past a busy task */
+#define PROFILER_STACK_WORDS	512	/* snprintf in task_stats_format() */
+#define RTC_STACK_WORDS		512	/* snprintf/sscanf of the RTC menu */
+
+/* Fails the build if the tables (and the kernel's idle/timer tasks) outgrow it */
+#define RTOS_RAM_BUDGET		(16 * 1024)
+
+/* Stop mode stays locked this long after the last key (power_tickless.c) */
+#define MENU_AWAKE_MS		10000
+
+#define RTOS_TASKS(X)																			\
+	X(menu, handle_menu_task, menu_task, TASK_STACK_WORDS, TASK_PRIORITY)						\
+	X(cmd, handle_cmd_task, cmd_task, TASK_STACK_WORDS, TASK_PRIORITY)							\
+	X(print, handle_print_task, print_task, TASK_STACK_WORDS, TASK_PRIORITY)					\
+	X(led, handle_led_task, led_task, TASK_STACK_WORDS, TASK_PRIORITY)							\
+	X(rtc, handle_rtc_task, rtc_task, RTC_STACK_WORDS, TASK_PRIORITY)							\
+	X(profiler, handle_profiler_task, profiler_task, PROFILER_STACK_WORDS, PROFILER_PRIORITY)
+
+#define RTOS_QUEUES(X)							\
+	X(q_data, q_data, 10, sizeof(char))			\
+	X(q_print, q_print, 10, sizeof(size_t))
+
+/* LED effects e1..e4; the timer ID is the effect number */
+#define RTOS_TIMERS(X)																	\
+	X(led_timer1, handle_led_timer[0], 1000, pdTRUE, 1, led_effect_callback)			\
+	X(led_timer2, handle_led_timer[1], 1000, pdTRUE, 2, led_effect_callback)			\
+	X(led_timer3, handle_led_timer[2], 1000, pdTRUE, 3, led_effect_callback)			\
+	X(led_timer4, handle_led_timer[3], 1000, pdTRUE, 4, led_effect_callback)			\
+	X(menu_idle_timer, handle_menu_idle_timer, MENU_AWAKE_MS, pdFALSE, 0, menu_idle_callback)
+
+#endif /* APP_OBJECTS_H_ */
@@ -35,6 +35,8 @@ extern "C" {
 #include "task.h"
 #include "queue.h"
 #include "timers.h"
+#include "power_mgr.h"
+#include "time_sync.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -63,12 +65,17 @@ extern xTaskHandle handle_cmd_task;
 extern xTaskHandle handle_print_task;
 extern xTaskHandle handle_led_task;
 extern  xTaskHandle handle_rtc_task;
+extern xTaskHandle handle_profiler_task;
 
 extern QueueHandle_t q_data;
 extern QueueHandle_t q_print;
 
+extern volatile uint8_t user_data;
 extern state_t curr_state; 
 extern TimerHandle_t handle_led_timer[4];
+extern TimerHandle_t handle_menu_idle_timer;
+
+extern power_policy_t power;
 
 /* USER CODE END ET */
 
@@ -91,6 +98,26 @@ void cmd_task(void * param);
 void print_task(void * param);
 void led_task(void * param);
 void rtc_task(void * param);
+void profiler_task(void * param);
+void led_effect_callback(TimerHandle_t xTimer);
+void menu_idle_callback(TimerHandle_t xTimer);
+
+void power_tickless_init(void);
+void power_menu_activity_from_isr(void);
+
+void time_service_init(void);
+void time_service_irq(void);
+void time_service_sync(void);
+void time_stop_elapsed(uint32_t slept_us);
+uint64_t time_mono_us(void);
+int64_t time_now_us(void);
+void time_service_state(time_sync_t *out);
+
+int64_t rtc_read_us(void);
+int rtc_configure_time(uint32_t hours, uint32_t minutes, uint32_t seconds);
+int rtc_configure_date(uint32_t day, uint32_t month, uint32_t year);
+void show_time_date(void);
+void rtc_report(void);
 
 void led_effect_stop(void);
 void led_effect(int n); 
@@ -80,3 +80,32 @@ void LED_effect4(void){
     static int i = 0; 
     LED_control( 0x8 >> (i++ %4)); 
 }
+
+/* Auto-reload timer of effect n; the timer ID is n (app_objects.h) */
+void led_effect_callback(TimerHandle_t xTimer)
+{
+    int id; 
+    id = (int) (uintptr_t) pvTimerGetTimerID (xTimer); 
+
+    switch (id)
+    {
+      case 1:
+        LED_effect1(); 
+        break;
+
+      case 2:
+        LED_effect2(); 
+        break;
+        
+      case 3:
+        LED_effect3(); 
+        break;
+        
+      case 4:
+        LED_effect4(); 
+        break;  
+    
+      default:
+        break;
+    }
+}
@@ -25,6 +25,7 @@
 #include <stdio.h>
 #include "FreeRTOS.h"
 #include "task.h"
+#include "rtos_objects.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -53,11 +54,13 @@ xTaskHandle handle_cmd_task;
 xTaskHandle handle_print_task;
 xTaskHandle handle_led_task;
 xTaskHandle handle_rtc_task;
+xTaskHandle handle_profiler_task;
 
 QueueHandle_t q_data;
 QueueHandle_t q_print;
 // software timers
 TimerHandle_t handle_led_timer[4]; 
+TimerHandle_t handle_menu_idle_timer;
 
 volatile uint8_t user_data;
 
@@ -70,7 +73,7 @@ static void MX_GPIO_Init(void);
 static void MX_USART2_UART_Init(void);
 static void MX_RTC_Init(void);
 /* USER CODE BEGIN PFP */
-void led_effect_callback(TimerHandle_t xTimer);
+
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
@@ -86,7 +89,7 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
-  BaseType_t status;
+
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -118,33 +121,21 @@ int main(void)
 //      HAL_Delay(1000);
 //    }
 
-  status = xTaskCreate(menu_task, "menu_task", 250, NULL, 5, &handle_menu_task);
-  configASSERT(status == pdPASS);
-
-  status = xTaskCreate(cmd_task, "cmd_task", 250, NULL, 5, &handle_cmd_task);
-  configASSERT(status == pdPASS);
-
-  status = xTaskCreate(print_task, "print_task", 250, NULL, 5, &handle_print_task);
-  configASSERT(status == pdPASS);
+  // tasks, queues and LED timers are listed in app_objects.h and live in
+  // static storage; there is no FreeRTOS heap to run out of
+  rtos_objects_create();
+  rtos_objects_start();
 
-  status = xTaskCreate(led_task, "led_task", 250, NULL, 5, &handle_led_task);
-  configASSERT(status == pdPASS);
+  // RAM budget over ITM/SWO
+  rtos_objects_report();
 
-  status = xTaskCreate(rtc_task, "rtc_task", 250, NULL, 5, &handle_rtc_task);
-  configASSERT(status == pdPASS);
+  // microsecond clock on TIM2, disciplined against the RTC by rtc_task
+  time_service_init();
 
-  q_data = xQueueCreate(10, sizeof(char));
-  configASSERT(q_data != NULL);
-
-  q_print = xQueueCreate(10, sizeof(size_t));
-  configASSERT(q_print != NULL);
-
-  // create software timers
-  for (int i=0; i<4; i++){
-      handle_led_timer[i] = xTimerCreate("led_timer", pdMS_TO_TICKS(1000), pdTRUE, (void *)(i+1), led_effect_callback);
-  }
+  // RTC wake-up timer and the state table for tickless idle
+  power_tickless_init();
 
-  HAL_UART_Receive_IT(&huart2,(uint8_t *) user_data, 1 );
+  HAL_UART_Receive_IT(&huart2, (uint8_t *) &user_data, 1);
 
   vTaskStartScheduler();
   /* USER CODE END 2 */
@@ -228,9 +219,9 @@ static void MX_RTC_Init(void)
   /** Initialize RTC Only
   */
   hrtc.Instance = RTC;
-  hrtc.Init.HourFormat = RTC_HOURFORMAT_12;
-  hrtc.Init.AsynchPrediv = 127;
-  hrtc.Init.SynchPrediv = 255;
+  hrtc.Init.HourFormat = RTC_HOURFORMAT_24;
+  hrtc.Init.AsynchPrediv = 7;
+  hrtc.Init.SynchPrediv = 3999;
   hrtc.Init.OutPut = RTC_OUTPUT_DISABLE;
   hrtc.Init.OutPutPolarity = RTC_OUTPUT_POLARITY_HIGH;
   hrtc.Init.OutPutType = RTC_OUTPUT_TYPE_OPENDRAIN;
@@ -324,58 +315,6 @@ static void MX_GPIO_Init(void)
 
 /* USER CODE BEGIN 4 */
 
-void led_effect_callback(TimerHandle_t xTimer)
-{
-    int id; 
-    id = (uint32_t) pvTimerGetTimerID (xTimer); 
-
-    switch (id)
-    {
-      case 1:
-        LED_effect1(); 
-        break;
-
-      case 2:
-        LED_effect2(); 
-        break;
-        
-      case 3:
-        LED_effect3(); 
-        break;
-        
-      case 4:
-        LED_effect4(); 
-        break;  
-    
-      default:
-        break;
-    }
-}
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
-{
-	uint8_t dummy;
-	if(! xQueueIsQueueFullFromISR(q_data)){
-		/* Enqueqe data byte */
-		xQueueSendFromISR(q_data, (void *) &user_data, NULL);
-	}else{
-		if(user_data == '\n'){
-			/*Make sure that last data byte of the queue is '\n' */
-			xQueueReceiveFromISR(q_data, (void *) &dummy, NULL);
-			xQueueSendFromISR(q_data, (void *) &user_data, NULL);
-		}
-	}
-
-	/*Send notificartions to command handling task if user_data = '\n' */
-	if(user_data == '\n'){
-		/*'\n' Send notificartions to command handling task*/
-		xTaskNotifyFromISR(handle_cmd_task, 0, eNoAction, NULL);
-	}
-
-	/* Enable_UART_Receive_IT*/
-	HAL_UART_Receive_IT(&huart2, (uint8_t *) &user_data, 1);
-
-}
-
 /* USER CODE END 4 */
 
 /**
@@ -0,0 +1,146 @@
+/*
+ * power_tickless.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Rahul B.
+ *
+ *  Tickless idle (configUSE_TICKLESS_IDLE 2). When every task is blocked for
+ *  at least configEXPECTED_IDLE_TIME_BEFORE_SLEEP ticks, the kernel calls
+ *  vPortSuppressTicksAndSleep() with the time to its next timeout (delays,
+ *  block times and software timers). The SysTick is stopped and power_mgr
+ *  sleeps in the deepest state the policy allows, woken by the RTC; the
+ *  kernel tick count is then stepped by the time the RTC measured, and so
+ *  is the time service after stop, which halts its timer (time_service.c).
+ *  The DWT cycle counter of the run-time stats stops with the core clock,
+ *  so the slept cycles it missed are added to it: they go to the idle
+ *  task, which is the one running.
+ *
+ *  Standby is locked out: the kernel lives in RAM. Stop would cut off
+ *  USART2, so while the menu is in use (MENU_AWAKE_MS after the last key)
+ *  stop is locked too. Out of that window the RX pin wakes the core from
+ *  stop through EXTI 3; that first byte is lost, the next ones arrive.
+ */
+
+#include "main.h"
+#include "power_mgr.h"
+
+#define TICK_US		(1000000u / configTICK_RATE_HZ)
+
+void SystemClock_Config(void);	/* main.c */
+extern UART_HandleTypeDef huart2;
+
+power_policy_t power;
+
+static uint32_t tick_rest_us;	/* slept time not yet stepped into the tick count */
+static uint8_t menu_awake;
+
+/* After rtos_objects_create(): the menu starts awake, its timer running */
+void power_tickless_init(void)
+{
+	Power_Init(&power);
+	power_policy_lock(&power, POWER_STANDBY);
+
+	menu_awake = 1;
+	power_policy_lock(&power, POWER_STOP);
+	xTimerStart(handle_menu_idle_timer, 0);
+}
+
+void power_menu_activity_from_isr(void)
+{
+	UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+
+	if(!menu_awake){
+		menu_awake = 1;
+		power_policy_lock(&power, POWER_STOP);
+	}
+	taskEXIT_CRITICAL_FROM_ISR(saved);
+	xTimerResetFromISR(handle_menu_idle_timer, NULL);
+}
+
+void menu_idle_callback(TimerHandle_t xTimer)
+{
+	(void)xTimer;
+	taskENTER_CRITICAL();
+	if(menu_awake){
+		menu_awake = 0;
+		power_policy_unlock(&power, POWER_STOP);
+	}
+	taskEXIT_CRITICAL();
+}
+
+/* PA3 stays in USART2 mode; EXTI only watches its input for a start bit */
+void Power_BeforeStop(void)
+{
+	/* The print task returns with its last byte still shifting out */
+	while(__HAL_UART_GET_FLAG(&huart2, UART_FLAG_TC) == RESET);
+
+	SYSCFG->EXTICR[0] = (SYSCFG->EXTICR[0] & ~SYSCFG_EXTICR1_EXTI3) | SYSCFG_EXTICR1_EXTI3_PA;
+	EXTI->PR = EXTI_PR_PR3;
+	EXTI->FTSR |= EXTI_FTSR_TR3;
+	EXTI->IMR |= EXTI_IMR_MR3;
+	HAL_NVIC_EnableIRQ(EXTI3_IRQn);
+}
+
+void Power_AfterStop(void)
+{
+	EXTI->IMR &= ~EXTI_IMR_MR3;
+	EXTI->FTSR &= ~EXTI_FTSR_TR3;
+	EXTI->PR = EXTI_PR_PR3;
+	HAL_NVIC_DisableIRQ(EXTI3_IRQn);
+	NVIC_ClearPendingIRQ(EXTI3_IRQn);
+
+	/* Stop mode leaves the core on HSI; back to the PLL before anything runs */
+	SystemClock_Config();
+}
+
+/* Cycles the DWT counter missed out of slept_us, at the clock we woke to */
+static void charge_slept_cycles(uint32_t counted, uint32_t slept_us)
+{
+	uint64_t slept = (uint64_t)slept_us * (SystemCoreClock / 1000000u);
+
+	if(slept > counted){
+		DWT->CYCCNT += (uint32_t)(slept - counted);	/* wraps as the counter does */
+	}
+}
+
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
+{
+	uint32_t slept_us;
+	uint32_t idle_us;
+	uint32_t cycles;
+
+	/* Masked, so an interrupt that ends the sleep runs only after the
+	   clocks and the tick count are right again */
+	__disable_irq();
+	__DSB();
+	__ISB();
+
+	if(eTaskConfirmSleepModeStatus() == eAbortSleep){
+		__enable_irq();
+		return;
+	}
+
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+	cycles = DWT->CYCCNT;
+
+	idle_us = xExpectedIdleTime >= Power_MaxSleepUs() / TICK_US ? Power_MaxSleepUs() : xExpectedIdleTime * TICK_US;
+	if(Power_Idle(&power, idle_us, &slept_us) == POWER_STOP){
+		time_stop_elapsed(slept_us);	/* TIM2 did not count */
+	}
+	charge_slept_cycles(DWT->CYCCNT - cycles, slept_us);
+
+	/* Whole ticks only; the rest is carried to the next sleep. The RTC may
+	   run a little fast, but the kernel must not be stepped past its
+	   next timeout. */
+	tick_rest_us += slept_us;
+	TickType_t ticks = tick_rest_us / TICK_US;
+	tick_rest_us %= TICK_US;
+	if(ticks > xExpectedIdleTime){
+		ticks = xExpectedIdleTime;
+	}
+	vTaskStepTick(ticks);
+
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+	__enable_irq();
+}
@@ -0,0 +1,88 @@
+/*
+ * profiler.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Rahul B.
+ *
+ *  Task profiler: every PROFILER_PERIOD_MS it samples uxTaskGetSystemState()
+ *  and sends one telemetry line (see task_stats.h) through the print task
+ *  to USART2.
+ *
+ *  Run time is counted in CPU cycles by the DWT cycle counter (84 MHz, so the
+ *  32-bit counter wraps every 51 s; the period must stay well below that).
+ *  The counter stops in sleep and stop; power_tickless.c adds the slept
+ *  cycles back, so the idle task's share is the true idle time.
+ *  Context switches are counted by traceTASK_SWITCHED_IN in FreeRTOSConfig.h.
+ */
+
+#include "main.h"
+#include "task_stats.h"
+
+#define PROFILER_PERIOD_MS	5000
+#define LINE_LEN			256
+
+volatile uint32_t profiler_switches[PROFILER_MAX_TASKS];
+
+static task_stats_t stats;
+static TaskStatus_t status[TASK_STATS_MAX_TASKS];
+static task_stats_sample_t samples[TASK_STATS_MAX_TASKS];
+/* The print task sends the line after we queue it, so alternate buffers */
+static char lines[2][LINE_LEN];
+static char power_line[64];
+
+void profiler_timer_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static int sample(void)
+{
+	uint32_t total = 0;
+	UBaseType_t n = uxTaskGetSystemState(status, TASK_STATS_MAX_TASKS, &total);
+	TaskHandle_t idle = xTaskGetIdleTaskHandle();
+
+	for (UBaseType_t i = 0; i < n; i++) {
+		samples[i].id = status[i].xTaskNumber;
+		samples[i].name = status[i].pcTaskName;
+		samples[i].priority = status[i].uxCurrentPriority;
+		samples[i].runtime = status[i].ulRunTimeCounter;
+		samples[i].stack_free = status[i].usStackHighWaterMark * sizeof(StackType_t);
+		samples[i].switches = profiler_switches[status[i].xTaskNumber & (PROFILER_MAX_TASKS - 1)];
+		samples[i].idle = (status[i].xHandle == idle);
+	}
+
+	/* No kernel heap in this app: every object is static (app_objects.h) */
+	return task_stats_update(&stats, samples, n, total, (uint64_t)xTaskGetTickCount() * 1000 / configTICK_RATE_HZ * 1000,
+							 0, 0);
+}
+
+void profiler_task(void *param)
+{
+	TickType_t last_wake = xTaskGetTickCount();
+	int next = 0;
+
+	task_stats_init(&stats, 1);
+	sample();
+	while(1){
+		vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(PROFILER_PERIOD_MS));
+		if(!sample()) continue;
+
+		char *line = lines[next];
+		next ^= 1;
+		size_t len = task_stats_format(&stats, line, LINE_LEN - 1);
+		line[len++] = '\n';
+		line[len] = '\0';
+		xQueueSend(q_print, &line, 0);	/* drop the sample rather than stall */
+
+		/* Where the time went since boot (power_tickless.c), in 0.01 % */
+		char *pline = power_line;
+		uint16_t run = power_policy_share(&power, POWER_RUN);
+		uint16_t slp = power_policy_share(&power, POWER_SLEEP);
+		uint16_t stp = power_policy_share(&power, POWER_STOP);
+		snprintf(pline, sizeof(power_line), "power run=%u.%02u sleep=%u.%02u stop=%u.%02u\n",
+				 run / 100, run % 100, slp / 100, slp % 100, stp / 100, stp % 100);
+		xQueueSend(q_print, &pline, 0);
+	}
+}
@@ -3,4 +3,191 @@
  *
  *  Created on: Sep 9, 2025
  *      Author: lenovo
+ *
+ *  RTC calendar for the RTC menu and the time service. Times are counted in
+ *  microseconds since 2000-01-01 00:00:00, the start of the RTC's calendar;
+ *  the sub-second counter gives 250 us steps with LSI.
+ *
+ *  Every time the user sets the clock, the RTC's error since the previous
+ *  setting (kept in backup registers, so it survives resets) is its drift.
+ *  Over at least RTC_CAL_MIN_S that is turned into a new smooth calibration
+ *  (CALR), which holds from -487 to +488 ppm: enough for the LSE crystal,
+ *  not always for LSI.
  */
+
+#include "main.h"
+#include <stdlib.h>
+
+#define RTC_BKP_REF			RTC_BKP_DR0	/* seconds since 2000 of the last setting */
+#define RTC_BKP_CHECK		RTC_BKP_DR1
+#define RTC_BKP_MAGIC		0x7153C0DEu
+#define RTC_CAL_MIN_S		3600	/* shorter spans are too coarse with 1 s entries */
+#define RTC_CAL_MAX_ERR_S	60		/* larger errors are corrections, not drift */
+#define DAY_S				86400u
+
+#define PPM_ARGS(ppb)		((ppb) < 0 ? '-' : '+'), (unsigned long)(labs(ppb) / 1000), (unsigned long)(labs(ppb) % 1000)
+
+extern RTC_HandleTypeDef hrtc;
+
+static const uint16_t days_before_month[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+static int32_t last_drift_ppb;
+static char msg_time[80];
+static char msg_sync[128];
+
+static uint32_t days_since_2000(uint32_t year, uint32_t month, uint32_t day)
+{
+	uint32_t days = year * 365 + (year + 3) / 4 + days_before_month[month - 1] + day - 1;
+
+	if(month > 2 && year % 4 == 0){
+		days++;
+	}
+	return days;
+}
+
+static uint32_t days_in_month(uint32_t year, uint32_t month)
+{
+	if(month == 2){
+		return year % 4 == 0 ? 29 : 28;
+	}
+	return month == 12 ? 31 : days_before_month[month] - days_before_month[month - 1];
+}
+
+/* Calendar fields of a time since 2000 */
+static void rtc_split(int64_t us, RTC_TimeTypeDef *time, RTC_DateTypeDef *date)
+{
+	uint32_t secs = (uint32_t)(us / 1000000);
+	uint32_t days = secs / DAY_S;
+	uint32_t year = 0;
+	uint32_t month = 1;
+
+	/* 2000-01-01 was a Saturday; the RTC counts Monday as 1 */
+	date->WeekDay = (days + 5) % 7 + 1;
+	while(days >= (year % 4 == 0 ? 366u : 365u)){
+		days -= year % 4 == 0 ? 366 : 365;
+		year++;
+	}
+	while(days >= days_in_month(year, month)){
+		days -= days_in_month(year, month);
+		month++;
+	}
+	date->Year = year;
+	date->Month = month;
+	date->Date = days + 1;
+
+	secs %= DAY_S;
+	time->Hours = secs / 3600;
+	time->Minutes = secs / 60 % 60;
+	time->Seconds = secs % 60;
+	time->TimeFormat = RTC_HOURFORMAT12_AM;
+	time->DayLightSaving = RTC_DAYLIGHTSAVING_NONE;
+	time->StoreOperation = RTC_STOREOPERATION_RESET;
+}
+
+int64_t rtc_read_us(void)
+{
+	RTC_TimeTypeDef time;
+	RTC_DateTypeDef date;
+
+	/* GetTime reads SSR and TR, which freezes the calendar until GetDate reads DR */
+	HAL_RTC_GetTime(&hrtc, &time, RTC_FORMAT_BIN);
+	HAL_RTC_GetDate(&hrtc, &date, RTC_FORMAT_BIN);
+
+	uint32_t secs = days_since_2000(date.Year, date.Month, date.Date) * DAY_S
+					+ time.Hours * 3600u + time.Minutes * 60u + time.Seconds;
+	uint32_t sub = time.SubSeconds <= time.SecondFraction
+					? (uint32_t)((uint64_t)(time.SecondFraction - time.SubSeconds) * 1000000u / (time.SecondFraction + 1))
+					: 0;
+	return (int64_t)secs * 1000000 + sub;
+}
+
+/* "dd-mm-20yy hh:mm:ss.mmm" */
+static int rtc_format(char *buf, size_t len, int64_t us)
+{
+	RTC_TimeTypeDef time;
+	RTC_DateTypeDef date;
+
+	rtc_split(us, &time, &date);
+	return snprintf(buf, len, "%02u-%02u-20%02u %02u:%02u:%02u.%03lu", date.Date, date.Month, date.Year,
+					time.Hours, time.Minutes, time.Seconds, (unsigned long)(us % 1000000 / 1000));
+}
+
+/* Moves the calendar to ref_us, and recalibrates from the drift since the
+   last setting */
+static void rtc_set(int64_t ref_us)
+{
+	RTC_TimeTypeDef time;
+	RTC_DateTypeDef date;
+	uint32_t ref_s = (uint32_t)(ref_us / 1000000);
+
+	if(HAL_RTCEx_BKUPRead(&hrtc, RTC_BKP_CHECK) == RTC_BKP_MAGIC){
+		uint32_t last_s = HAL_RTCEx_BKUPRead(&hrtc, RTC_BKP_REF);
+		int64_t err_us = rtc_read_us() - ref_us;
+
+		if(ref_s >= last_s + RTC_CAL_MIN_S && llabs(err_us) < RTC_CAL_MAX_ERR_S * 1000000LL){
+			/* us per s is ppm, so us * 1000 per s is ppb */
+			last_drift_ppb = (int32_t)(err_us * 1000 / (ref_s - last_s));
+			uint32_t calr = time_sync_rtc_calr(RTC->CALR & (RTC_CALR_CALP | RTC_CALR_CALM), last_drift_ppb);
+			HAL_RTCEx_SetSmoothCalib(&hrtc, RTC_SMOOTHCALIB_PERIOD_32SEC,
+									 (calr & RTC_CALR_CALP) ? RTC_SMOOTHCALIB_PLUSPULSES_SET : RTC_SMOOTHCALIB_PLUSPULSES_RESET,
+									 calr & RTC_CALR_CALM);
+		}
+	}
+
+	rtc_split(ref_us, &time, &date);
+	HAL_RTC_SetTime(&hrtc, &time, RTC_FORMAT_BIN);
+	HAL_RTC_SetDate(&hrtc, &date, RTC_FORMAT_BIN);
+	HAL_RTCEx_BKUPWrite(&hrtc, RTC_BKP_REF, ref_s);
+	HAL_RTCEx_BKUPWrite(&hrtc, RTC_BKP_CHECK, RTC_BKP_MAGIC);
+
+	/* Step the time service onto the new calendar */
+	time_service_sync();
+}
+
+int rtc_configure_time(uint32_t hours, uint32_t minutes, uint32_t seconds)
+{
+	if(hours > 23 || minutes > 59 || seconds > 59){
+		return -1;
+	}
+	int64_t day_us = rtc_read_us() / (DAY_S * 1000000LL) * (DAY_S * 1000000LL);
+	rtc_set(day_us + (int64_t)(hours * 3600 + minutes * 60 + seconds) * 1000000);
+	return 0;
+}
+
+int rtc_configure_date(uint32_t day, uint32_t month, uint32_t year)
+{
+	if(year > 99 || month < 1 || month > 12 || day < 1 || day > days_in_month(year, month)){
+		return -1;
+	}
+	int64_t time_us = rtc_read_us() % (DAY_S * 1000000LL);
+	rtc_set((int64_t)days_since_2000(year, month, day) * DAY_S * 1000000 + time_us);
+	return 0;
+}
+
+void show_time_date(void)
+{
+	char *msg = msg_time;
+	int len = snprintf(msg, sizeof(msg_time), "Current date and time : ");
+
+	len += rtc_format(msg + len, sizeof(msg_time) - len, time_now_us());
+	snprintf(msg + len, sizeof(msg_time) - len, "\n");
+	xQueueSend(q_print, &msg, portMAX_DELAY);
+}
+
+/* How the time service and the RTC calibration are doing */
+void rtc_report(void)
+{
+	char *msg = msg_sync;
+	time_sync_t sync;
+
+	time_service_state(&sync);
+	int32_t rate_ppb = time_sync_freq_ppb(&sync);
+	int32_t cal_ppb = time_sync_calr_ppb(RTC->CALR);
+
+	snprintf(msg, sizeof(msg_sync),
+			 "Clock vs RTC : offset %ld us, rate %c%lu.%03lu ppm\n"
+			 "RTC CALR     : 0x%04lx, %c%lu.%03lu ppm (last drift %c%lu.%03lu ppm)\n",
+			 (long)sync.offset_us, PPM_ARGS(rate_ppb),
+			 (unsigned long)RTC->CALR, PPM_ARGS(cal_ppb), PPM_ARGS(last_drift_ppb));
+	xQueueSend(q_print, &msg, portMAX_DELAY);
+}
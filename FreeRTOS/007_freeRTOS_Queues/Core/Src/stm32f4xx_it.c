@@ -190,4 +190,28 @@ void TIM6_DAC_IRQHandler(void)
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles RTC wake-up interrupt through EXTI line 22.
+  */
+void RTC_WKUP_IRQHandler(void)
+{
+  Power_WakeupIRQHandler();
+}
+
+/**
+  * @brief This function handles EXTI line3 interrupt (USART2 RX wake-up from stop).
+  */
+void EXTI3_IRQHandler(void)
+{
+  EXTI->PR = EXTI_PR_PR3;
+}
+
+/**
+  * @brief This function handles TIM2 global interrupt (time service overflow).
+  */
+void TIM2_IRQHandler(void)
+{
+  time_service_irq();
+}
+
 /* USER CODE END 1 */
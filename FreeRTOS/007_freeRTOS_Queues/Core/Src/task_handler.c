@@ -6,6 +6,17 @@
  */
 #include "main.h"
 
+/* RTC samples for the time service while the rtc task waits (time_service.c) */
+#define TIME_SYNC_PERIOD_MS		16000
+
+/* Command lines, used in turn. A task gets the index of its command in the
+   notification value, which is 32 bits and so cannot hold a pointer on every
+   target (the host simulation is 64-bit). Two slots let the next line come in
+   while a task still reads the last one. */
+#define CMD_SLOTS				2
+
+static command_t commands[CMD_SLOTS];
+
 int extract_command(command_t *cmd);
 void process_command(command_t *cmd);
 
@@ -15,7 +26,7 @@ const char * msg_inv = "	Invalid option	 \n";
 
 void menu_task(void * param)
 {
-	uint32_t cmd_addr; 
+	uint32_t cmd_slot; 
 	command_t *cmd ; 
 
 	int option; 
@@ -31,9 +42,9 @@ void menu_task(void * param)
 
 	while(1){
 		xQueueSend(q_print, &msg_menu, portMAX_DELAY); 
-		xTaskNotifyWait(0,0,&cmd_addr, portMAX_DELAY); 
+		xTaskNotifyWait(0,0,&cmd_slot, portMAX_DELAY); 
 
-		cmd = (command_t *) cmd_addr; 
+		cmd = &commands[cmd_slot % CMD_SLOTS]; 
 		if(cmd ->len ==1 )
 		{ 
 			option = cmd->payload[0] - 48; 
@@ -45,7 +56,7 @@ void menu_task(void * param)
 				break;
 
 				case 1:
-					curr_state = sLedEffect; 
+					curr_state = sRtcMenu; 
 					xTaskNotify(handle_rtc_task, 0, eNoAction); 
 				break;
 
@@ -92,24 +103,25 @@ int extract_command(command_t *cmd)
 } 
 
 void process_command(command_t *cmd){
+	uint32_t slot = (uint32_t)(cmd - commands);
 	
 	extract_command(cmd); 
 
 	switch (curr_state)
 	{
 	case sMainMenu:
-		xTaskNotify(handle_menu_task, (uint32_t)cmd, eSetValueWithOverwrite); 
+		xTaskNotify(handle_menu_task, slot, eSetValueWithOverwrite); 
 	break;
 	
 	case sLedEffect:
-		xTaskNotify(handle_led_task, (uint32_t)cmd, eSetValueWithOverwrite); 
+		xTaskNotify(handle_led_task, slot, eSetValueWithOverwrite); 
 	break;
 	
 	case sRtcMenu :
 	case sRtcTimeConfig:
 	case sRtcDateConfig:
 	case sRtcReport:
-		xTaskNotify(handle_rtc_task, (uint32_t)cmd, eSetValueWithOverwrite); 
+		xTaskNotify(handle_rtc_task, slot, eSetValueWithOverwrite); 
 	break; 
 
 	default:
@@ -121,13 +133,14 @@ void process_command(command_t *cmd){
 void cmd_task(void * param)
 {
 	BaseType_t ret; 
-	command_t cmd; 
+	uint32_t slot = 0; 
 
 	while(1){
 		/*Implement notify wait*/
 		ret = xTaskNotifyWait(0, 0, NULL, portMAX_DELAY);
 		if(ret == pdTRUE){
-			process_command(&cmd); 
+			process_command(&commands[slot]); 
+			slot = (slot + 1) % CMD_SLOTS;
 		}
 		 
 	}
@@ -135,7 +148,7 @@ void cmd_task(void * param)
 
 void print_task(void * param)
 {
-	uint32_t *msg;
+	const char *msg;
 	while(1){
 		xQueueReceive(q_print, &msg, portMAX_DELAY);
 		HAL_UART_Transmit(&huart2, (uint8_t *) msg, strlen(msg), HAL_MAX_DELAY);
@@ -144,7 +157,7 @@ void print_task(void * param)
 
 void led_task(void *param)
 {
-	uint32_t cmd_addr;
+	uint32_t cmd_slot;
 	command_t *cmd;
 	const char* msg_led = "==========================\n"
 						  "|      LED Effect     	|\n"
@@ -158,8 +171,8 @@ void led_task(void *param)
 		/*TODO: Print LED menu */
 		xQueueSend(q_print, &msg_led, portMAX_DELAY); 
 		/*TODO: wait for LED command (Notify wait) */
-		xTaskNotifyWait(0,0,&cmd_addr, portMAX_DELAY);
-		cmd = (command_t *) cmd_addr;  
+		xTaskNotifyWait(0,0,&cmd_slot, portMAX_DELAY);
+		cmd = &commands[cmd_slot % CMD_SLOTS];  
 
 		if(cmd->len <= 4)
 		{
@@ -188,9 +201,120 @@ void led_task(void *param)
 	}
 }
 
+/* Waits for a notification like the other tasks, but keeps the time
+   service disciplined: the RTC is sampled every TIME_SYNC_PERIOD_MS without one */
+static void rtc_wait(uint32_t *value)
+{
+	while(xTaskNotifyWait(0, 0, value, pdMS_TO_TICKS(TIME_SYNC_PERIOD_MS)) != pdTRUE){
+		time_service_sync();
+	}
+}
+
 void rtc_task(void * param)
 {
+	uint32_t cmd_slot;
+	command_t *cmd;
+	unsigned int a, b, c;
+	char end;
+	const char* msg_rtc = "==========================\n"
+						  "|          RTC           |\n"
+						  "==========================\n"
+						  "Configure time      ---> 0\n"
+						  "Configure date      ---> 1\n"
+						  "Clock sync report   ---> 2\n"
+						  "Exit                ---> 3\n"
+						  "Enter your choice here :   ";
+	const char* msg_time = "Enter time (hh:mm:ss, 24 h) : ";
+	const char* msg_date = "Enter date (dd-mm-yy) : ";
+	const char* msg_conf = "Configuration successful\n";
+
+	/* The first sample steps the clock onto the RTC */
+	time_service_sync();
+
 	while(1){
+		rtc_wait(NULL);
+		show_time_date();
+		xQueueSend(q_print, &msg_rtc, portMAX_DELAY);
+
+		while(curr_state != sMainMenu){
+			rtc_wait(&cmd_slot);
+			cmd = &commands[cmd_slot % CMD_SLOTS];
+
+			switch(curr_state){
+			case sRtcMenu:
+				if(cmd->len == 1 && cmd->payload[0] == '0'){
+					curr_state = sRtcTimeConfig;
+					xQueueSend(q_print, &msg_time, portMAX_DELAY);
+				}else if(cmd->len == 1 && cmd->payload[0] == '1'){
+					curr_state = sRtcDateConfig;
+					xQueueSend(q_print, &msg_date, portMAX_DELAY);
+				}else if(cmd->len == 1 && cmd->payload[0] == '2'){
+					curr_state = sRtcReport;
+					rtc_report();
+					curr_state = sMainMenu;
+				}else{
+					if(cmd->len != 1 || cmd->payload[0] != '3')
+						xQueueSend(q_print, &msg_inv, portMAX_DELAY);
+					curr_state = sMainMenu;
+				}
+				break;
+
+			case sRtcTimeConfig:
+				if(sscanf((char*)cmd->payload, "%2u:%2u:%2u%c", &a, &b, &c, &end) == 3 && rtc_configure_time(a, b, c) == 0){
+					xQueueSend(q_print, &msg_conf, portMAX_DELAY);
+					show_time_date();
+				}else{
+					xQueueSend(q_print, &msg_inv, portMAX_DELAY);
+				}
+				curr_state = sMainMenu;
+				break;
 
+			case sRtcDateConfig:
+				if(sscanf((char*)cmd->payload, "%2u-%2u-%2u%c", &a, &b, &c, &end) == 3 && rtc_configure_date(a, b, c) == 0){
+					xQueueSend(q_print, &msg_conf, portMAX_DELAY);
+					show_time_date();
+				}else{
+					xQueueSend(q_print, &msg_inv, portMAX_DELAY);
+				}
+				curr_state = sMainMenu;
+				break;
+
+			default:
+				curr_state = sMainMenu;
+				break;
+			}
+		}
+
+		xTaskNotify(handle_menu_task, 0, eNoAction);
 	}
 }
+
+/* One byte from USART2 into q_data; a full line wakes the command task */
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+	uint8_t dummy;
+
+	/* Keep stop mode off while someone is typing */
+	power_menu_activity_from_isr();
+
+	if(! xQueueIsQueueFullFromISR(q_data)){
+		/* Enqueqe data byte */
+		xQueueSendFromISR(q_data, (void *) &user_data, NULL);
+	}else{
+		if(user_data == '\n'){
+			/*Make sure that last data byte of the queue is '\n' */
+			xQueueReceiveFromISR(q_data, (void *) &dummy, NULL);
+			xQueueSendFromISR(q_data, (void *) &user_data, NULL);
+		}
+	}
+
+	/*Send notificartions to command handling task if user_data = '\n' */
+	if(user_data == '\n'){
+		/*'\n' Send notificartions to command handling task*/
+		xTaskNotifyFromISR(handle_cmd_task, 0, eNoAction, NULL);
+	}
+
+	/* Enable_UART_Receive_IT*/
+	HAL_UART_Receive_IT(&huart2, (uint8_t *) &user_data, 1);
+
+}
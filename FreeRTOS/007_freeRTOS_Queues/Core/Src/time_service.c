@@ -0,0 +1,131 @@
+/*
+ * time_service.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Rahul B.
+ *
+ *  Microsecond clock for timestamps. TIM2 (32 bit) counts at 1 MHz and its
+ *  overflow interrupt extends it to 64 bits; that is the raw, monotonic
+ *  clock. TIM2 stops in stop mode, so power_tickless.c adds the time the RTC
+ *  measured there (a few hundred us of the wake-up are counted twice; the
+ *  discipline absorbs that).
+ *
+ *  time_sync.c disciplines the raw clock against the RTC calendar: rtc_task
+ *  samples the RTC every TIME_SYNC_PERIOD_MS, the frequency error between
+ *  HSI and the RTC clock is measured and the offset is slewed away, so
+ *  time_now_us() runs smoothly at the RTC's rate with microsecond steps
+ *  instead of the RTC's 250 us ones.
+ *
+ *  Readers mask interrupts for a few dozen cycles, so both clocks can be
+ *  read from any task or interrupt.
+ */
+
+#include "main.h"
+
+#define TIME_TICK_HZ		1000000u
+#define TIME_TIM_IRQ_PRIO	5
+
+static volatile uint32_t tim_high;	/* TIM2 overflows: the upper 32 bits */
+static volatile uint64_t stop_us;	/* time in stop mode, when TIM2 does not count */
+static time_sync_t sync;
+
+/* LSI may be off by several percent, HSI by 1 % */
+static const time_sync_config_t sync_config = {
+	.max_freq_ppm = 60000,
+	.slew_ppm = 500,
+	.step_us = 500000,
+	.freq_interval_us = 60000000,
+};
+
+void time_service_init(void)
+{
+	uint32_t tim_hz = HAL_RCC_GetPCLK1Freq();
+
+	/* Timers on APB1 run at twice PCLK1 unless the prescaler is 1 */
+	if((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1){
+		tim_hz *= 2;
+	}
+
+	time_sync_init(&sync, &sync_config);
+
+	__HAL_RCC_TIM2_CLK_ENABLE();
+	TIM2->CR1 = 0;
+	TIM2->PSC = tim_hz / TIME_TICK_HZ - 1;
+	TIM2->ARR = 0xFFFFFFFF;
+	TIM2->CNT = 0;
+	TIM2->EGR = TIM_EGR_UG;		/* load the prescaler */
+	TIM2->SR = 0;
+	TIM2->DIER = TIM_DIER_UIE;
+	HAL_NVIC_SetPriority(TIM2_IRQn, TIME_TIM_IRQ_PRIO, 0);
+	HAL_NVIC_EnableIRQ(TIM2_IRQn);
+	TIM2->CR1 = TIM_CR1_CEN;
+}
+
+void time_service_irq(void)
+{
+	if(TIM2->SR & TIM_SR_UIF){
+		TIM2->SR = ~TIM_SR_UIF;
+		tim_high++;
+	}
+}
+
+/* With interrupts masked */
+static uint64_t raw_us(void)
+{
+	uint32_t high = tim_high;
+	uint32_t cnt = TIM2->CNT;
+
+	/* Wrapped, but the interrupt has not run yet */
+	if((TIM2->SR & TIM_SR_UIF) && cnt < 0x80000000u){
+		high++;
+	}
+	return ((uint64_t)high << 32 | cnt) + stop_us;
+}
+
+uint64_t time_mono_us(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	uint64_t t = raw_us();
+	__set_PRIMASK(primask);
+	return t;
+}
+
+int64_t time_now_us(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	int64_t t = time_sync_now(&sync, raw_us());
+	__set_PRIMASK(primask);
+	return t;
+}
+
+/* power_tickless.c, interrupts masked */
+void time_stop_elapsed(uint32_t slept_us)
+{
+	stop_us += slept_us;
+}
+
+/* One RTC sample, stamped in the middle of the read */
+void time_service_sync(void)
+{
+	taskENTER_CRITICAL();
+	uint64_t before = time_mono_us();
+	int64_t ref = rtc_read_us();
+	uint64_t after = time_mono_us();
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	time_sync_update(&sync, before + (after - before) / 2, ref);
+	__set_PRIMASK(primask);
+	taskEXIT_CRITICAL();
+}
+
+/* Copy for reports, taken consistently */
+void time_service_state(time_sync_t *out)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	*out = sync;
+	__set_PRIMASK(primask);
+}
@@ -67,14 +67,16 @@
 #define configUSE_APPLICATION_TASK_TAG	0
 #define configUSE_COUNTING_SEMAPHORES	1
 #define configGENERATE_RUN_TIME_STATS	0
+/* Index 1 is ipc_bench.c's own start/done handshake, index 0 is measured */
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES	2
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES 		0
 #define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
 
 /* Software timer definitions. */
-#define configUSE_TIMERS				0
-#define configTIMER_TASK_PRIORITY		( 2 )
+#define configUSE_TIMERS				1
+#define configTIMER_TASK_PRIORITY		( configMAX_PRIORITIES - 1 )
 #define configTIMER_QUEUE_LENGTH		10
 #define configTIMER_TASK_STACK_DEPTH	( configMINIMAL_STACK_SIZE * 2 )
 
@@ -90,6 +92,8 @@ to exclude the API function. */
 
 #define INCLUDE_xTaskGetIdleTaskHandle  1
 #define INCLUDE_pxTaskGetStackStart		1
+/* xEventGroupSetBitsFromISR() defers to the timer task */
+#define INCLUDE_xTimerPendFunctionCall	1
 
 /* Cortex-M specific definitions. */
 #ifdef __NVIC_PRIO_BITS
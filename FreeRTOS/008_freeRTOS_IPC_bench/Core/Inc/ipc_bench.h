@@ -0,0 +1,90 @@
+/**
+ * @file ipc_bench.h
+ * @brief Latency and throughput of the FreeRTOS IPC primitives.
+ *
+ * One benchmark task runs every case in turn and prints a table per group:
+ *   queue     send and receive by item size (4, 16, 64, 256 bytes)
+ *   signal    task notification vs binary semaphore vs event group, mutex
+ *   buffer    stream and message buffers by message size
+ *   isr       handoff from an interrupt to a task, per primitive
+ *   create    create and delete of the objects, which is where heap and
+ *             static allocation differ
+ *
+ * Cases are named <group>[.<primitive>][.<size>B].<kind>.<unit>, e.g.
+ * queue.64B.handoff.cycles or isr.notify.handoff.ns, where kind is:
+ *   local     give and take in the benchmark task, no context switch
+ *   handoff   give to a higher-priority task blocked on the primitive,
+ *             until that task runs (wake-up and context switch included)
+ *   batch     per item, streaming to a task of the same priority through
+ *             a 16-item queue, which fills and drains in bursts
+ *   contended giving a mutex a higher-priority task is blocked on, until
+ *             that task holds it (priority inheritance undone on the way)
+ * Every case runs IPC_BENCH_RUNS times after IPC_BENCH_WARMUP unmeasured
+ * runs; the row gives mean, min, median, 99th percentile and max, less the
+ * cost of reading the clock, and the rate the mean allows per second.
+ *
+ * Rows are "key mean ..." and the other lines start with '#', so the
+ * output is a cycles.txt for stm32_superbuild's profile report as it is.
+ *
+ * The time source and the software interrupt come from the port below:
+ * bench_port.c on the board (DWT cycles, EXTI0 pended by software), the
+ * board.c of FreeRTOS/sim on the host (nanoseconds of the host clock). On
+ * the host every context switch hands over between two threads, so compare
+ * host rows with each other, not with the board's.
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#ifndef IPC_BENCH_H
+#define IPC_BENCH_H
+
+#include <stdint.h>
+
+#define IPC_BENCH_RUNS 200
+#define IPC_BENCH_WARMUP 8
+#define IPC_BENCH_MAX_RESULTS 48
+#define IPC_BENCH_KEY_LEN 40
+
+typedef struct {
+    char key[IPC_BENCH_KEY_LEN];
+    uint32_t mean;
+    uint32_t min;
+    uint32_t p50;
+    uint32_t p99;
+    uint32_t max;
+} ipc_bench_result_t;
+
+// ===== SUITE (ipc_bench.c) =====
+
+// Creates the benchmark task; it runs once the scheduler starts.
+void ipc_bench_start(void);
+
+// The software interrupt's handler.
+void ipc_bench_isr(void);
+
+// Results so far, in the order they ran.
+int ipc_bench_results(const ipc_bench_result_t **results);
+
+// ===== PORT =====
+
+// Starts the clock and sets up the software interrupt.
+void bench_port_init(void);
+
+// Free-running 32-bit clock; differences are valid across a wrap.
+uint32_t bench_clock_now(void);
+
+// Clock ticks per second.
+uint32_t bench_clock_hz(void);
+
+// "cycles" or "ns", the key suffix.
+const char *bench_clock_unit(void);
+
+// Runs ipc_bench_isr() as an interrupt, now.
+void bench_trigger_isr(void);
+
+// The suite is done; does not return.
+void bench_done(void);
+
+#endif // IPC_BENCH_H
@@ -0,0 +1,57 @@
+/*
+ * bench_port.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Rahul B.
+ *
+ *  ipc_bench.h's port on the board: the DWT cycle counter as the clock,
+ *  and EXTI line 0, which no pin drives here, as the software interrupt.
+ *  Its priority is below configMAX_SYSCALL_INTERRUPT_PRIORITY, as the
+ *  FromISR calls require.
+ */
+
+#include "main.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ipc_bench.h"
+
+#define BENCH_IRQ_PRIORITY	(configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1)
+
+void bench_port_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	HAL_NVIC_SetPriority(EXTI0_IRQn, BENCH_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(EXTI0_IRQn);
+}
+
+uint32_t bench_clock_now(void)
+{
+	return DWT->CYCCNT;
+}
+
+uint32_t bench_clock_hz(void)
+{
+	return SystemCoreClock;
+}
+
+const char *bench_clock_unit(void)
+{
+	return "cycles";
+}
+
+void bench_trigger_isr(void)
+{
+	NVIC_SetPendingIRQ(EXTI0_IRQn);
+	/* Taken before the next instruction completes; the barriers make sure */
+	__DSB();
+	__ISB();
+}
+
+void bench_done(void)
+{
+	vTaskSuspend(NULL);
+	for (;;);
+}
@@ -0,0 +1,508 @@
+/*
+ * ipc_bench.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Rahul B.
+ *
+ *  The IPC benchmark suite (see ipc_bench.h). The benchmark task runs at
+ *  PRIO_BENCH; one receiver task takes what it gives: at PRIO_HIGH for the
+ *  handoff cases, so every give wakes it at once, and at PRIO_BENCH for the
+ *  batch cases, so neither preempts the other and the queue fills and
+ *  drains in bursts. Notification index CTRL starts the receiver on a case and
+ *  tells the benchmark task it is done; index 0 is the one measured. In the
+ *  contended mutex case the two tasks take turns holding one mutex.
+ *
+ *  Objects come from the kernel heap, or from the static buffers below
+ *  when the build turns configSUPPORT_DYNAMIC_ALLOCATION off; only one
+ *  object of a kind exists at a time. Only the FreeRTOS API and
+ *  ipc_bench.h's port are used, so the host simulation (FreeRTOS/sim)
+ *  builds this file unchanged.
+ */
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+#include "ipc_bench.h"
+
+#define PRIO_BENCH		2	/* also the batch receiver */
+#define PRIO_HIGH		3	/* handoff receiver; the timer task is above it */
+#define BENCH_STACK		512
+#define RECEIVER_STACK	256
+#define CTRL			1	/* notification index of the start/done handshake */
+
+#define QUEUE_DEPTH		16
+#define BATCH_ITEMS		64
+#define BATCH_RUNS		16
+#define MAX_ITEM		256
+#define EVENT_BIT		(1u << 0)
+#define MESSAGE_BYTES(n)	(2 * ((n) + sizeof(size_t)))	/* two messages and their lengths */
+
+#if configSUPPORT_DYNAMIC_ALLOCATION
+#define ALLOCATION		"heap"
+#define TASK_CREATE(slot, f, name, depth, prio, handle)	xTaskCreate(f, name, depth, NULL, prio, handle)
+#define QUEUE_CREATE(n, size)		xQueueCreate(n, size)
+#define SEMAPHORE_CREATE()			xSemaphoreCreateBinary()
+#define MUTEX_CREATE()				xSemaphoreCreateMutex()
+#define GROUP_CREATE()				xEventGroupCreate()
+#define STREAM_CREATE(size, level)	xStreamBufferCreate(size, level)
+#define MESSAGE_CREATE(size)		xMessageBufferCreate(size)
+#else
+#define ALLOCATION		"static"
+static StackType_t stacks[2][BENCH_STACK];	/* per task slot */
+static StaticTask_t tcbs[2];
+static uint8_t queue_storage[QUEUE_DEPTH * MAX_ITEM];
+static StaticQueue_t queue_struct;
+static StaticSemaphore_t semaphore_struct;
+static StaticEventGroup_t group_struct;
+static uint8_t buffer_storage[MESSAGE_BYTES(MAX_ITEM) + 1];
+static StaticStreamBuffer_t buffer_struct;
+#define TASK_CREATE(slot, f, name, depth, prio, handle) \
+	((*(handle) = xTaskCreateStatic(f, name, depth, NULL, prio, stacks[slot], &tcbs[slot])) != NULL ? pdPASS : pdFAIL)
+#define QUEUE_CREATE(n, size)		xQueueCreateStatic(n, size, queue_storage, &queue_struct)
+#define SEMAPHORE_CREATE()			xSemaphoreCreateBinaryStatic(&semaphore_struct)
+#define MUTEX_CREATE()				xSemaphoreCreateMutexStatic(&semaphore_struct)
+#define GROUP_CREATE()				xEventGroupCreateStatic(&group_struct)
+#define STREAM_CREATE(size, level)	xStreamBufferCreateStatic(size, level, buffer_storage, &buffer_struct)
+#define MESSAGE_CREATE(size)		xMessageBufferCreateStatic(size, buffer_storage, &buffer_struct)
+#endif
+
+/* One primitive, as the benchmark task gives it and the receiver takes it */
+typedef struct {
+	void (*setup)(void);
+	void (*give)(void);
+	void (*give_from_isr)(BaseType_t *woken);
+	void (*take)(void);		/* blocks until given */
+	void (*release)(void);	/* after the take is recorded, e.g. a mutex given back */
+	void (*teardown)(void);
+} primitive_t;
+
+static TaskHandle_t bench_task;
+static TaskHandle_t receiver;
+static TaskHandle_t taker;		/* who takes the notifications: receiver or bench_task */
+
+static QueueHandle_t queue;
+static SemaphoreHandle_t semaphore;
+static SemaphoreHandle_t mutex;
+static EventGroupHandle_t group;
+static StreamBufferHandle_t stream;
+static MessageBufferHandle_t message;
+static size_t item_size;
+static uint8_t tx[MAX_ITEM];
+static uint8_t rx[MAX_ITEM];
+
+/* Case the receiver and the interrupt work on */
+static const primitive_t *volatile current;
+static volatile uint32_t receiver_items;
+static volatile bool receiver_records;
+static const primitive_t *volatile isr_primitive;	/* NULL: record the entry */
+
+static volatile uint32_t t_start;
+static uint32_t overhead;		/* of reading the clock twice */
+static uint32_t samples[IPC_BENCH_RUNS];
+static volatile uint32_t sample_count;
+static volatile uint32_t skip;	/* warm-up samples still to drop */
+
+static ipc_bench_result_t results[IPC_BENCH_MAX_RESULTS];
+static int result_count;
+
+// ===== PRIMITIVES =====
+
+static void queue_setup(void)			{ queue = QUEUE_CREATE(QUEUE_DEPTH, item_size); configASSERT(queue); }
+static void queue_give(void)			{ xQueueSend(queue, tx, portMAX_DELAY); }
+static void queue_give_isr(BaseType_t *w)	{ xQueueSendFromISR(queue, tx, w); }
+static void queue_take(void)			{ xQueueReceive(queue, rx, portMAX_DELAY); }
+static void queue_teardown(void)		{ vQueueDelete(queue); }
+
+static void notify_give(void)			{ xTaskNotifyGive(taker); }
+static void notify_give_isr(BaseType_t *w)	{ vTaskNotifyGiveFromISR(taker, w); }
+static void notify_take(void)			{ ulTaskNotifyTake(pdTRUE, portMAX_DELAY); }
+
+static void semaphore_setup(void)		{ semaphore = SEMAPHORE_CREATE(); configASSERT(semaphore); }
+static void semaphore_give(void)		{ xSemaphoreGive(semaphore); }
+static void semaphore_give_isr(BaseType_t *w)	{ xSemaphoreGiveFromISR(semaphore, w); }
+static void semaphore_take(void)		{ xSemaphoreTake(semaphore, portMAX_DELAY); }
+static void semaphore_teardown(void)	{ vSemaphoreDelete(semaphore); }
+
+static void group_setup(void)			{ group = GROUP_CREATE(); configASSERT(group); }
+static void group_give(void)			{ xEventGroupSetBits(group, EVENT_BIT); }
+/* Deferred to the timer task, which sets the bit */
+static void group_give_isr(BaseType_t *w)	{ xEventGroupSetBitsFromISR(group, EVENT_BIT, w); }
+static void group_take(void)			{ xEventGroupWaitBits(group, EVENT_BIT, pdTRUE, pdFALSE, portMAX_DELAY); }
+static void group_teardown(void)		{ vEventGroupDelete(group); }
+
+/* The receiver wakes once the whole message is in */
+static void stream_setup(void)			{ stream = STREAM_CREATE(2 * item_size, item_size); configASSERT(stream); }
+static void stream_give(void)			{ xStreamBufferSend(stream, tx, item_size, portMAX_DELAY); }
+static void stream_give_isr(BaseType_t *w)	{ xStreamBufferSendFromISR(stream, tx, item_size, w); }
+static void stream_take(void)			{ xStreamBufferReceive(stream, rx, item_size, portMAX_DELAY); }
+static void stream_teardown(void)		{ vStreamBufferDelete(stream); }
+
+static void message_setup(void)			{ message = MESSAGE_CREATE(MESSAGE_BYTES(item_size)); configASSERT(message); }
+static void message_give(void)			{ xMessageBufferSend(message, tx, item_size, portMAX_DELAY); }
+static void message_take(void)			{ xMessageBufferReceive(message, rx, item_size, portMAX_DELAY); }
+static void message_teardown(void)		{ vMessageBufferDelete(message); }
+
+static void mutex_setup(void)			{ mutex = MUTEX_CREATE(); configASSERT(mutex); }
+static void mutex_give(void)			{ xSemaphoreGive(mutex); }
+static void mutex_take(void)			{ xSemaphoreTake(mutex, portMAX_DELAY); }
+static void mutex_teardown(void)		{ vSemaphoreDelete(mutex); }
+
+static const primitive_t queue_primitive = { queue_setup, queue_give, queue_give_isr, queue_take, NULL, queue_teardown };
+static const primitive_t notify_primitive = { NULL, notify_give, notify_give_isr, notify_take, NULL, NULL };
+static const primitive_t semaphore_primitive = { semaphore_setup, semaphore_give, semaphore_give_isr, semaphore_take, NULL, semaphore_teardown };
+static const primitive_t group_primitive = { group_setup, group_give, group_give_isr, group_take, NULL, group_teardown };
+static const primitive_t stream_primitive = { stream_setup, stream_give, stream_give_isr, stream_take, NULL, stream_teardown };
+static const primitive_t message_primitive = { message_setup, message_give, NULL, message_take, NULL, message_teardown };
+static const primitive_t mutex_primitive = { mutex_setup, mutex_give, NULL, mutex_take, mutex_give, mutex_teardown };
+
+// ===== MEASUREMENT =====
+
+static uint32_t since(uint32_t t0)
+{
+	uint32_t elapsed = bench_clock_now() - t0;
+	return elapsed > overhead ? elapsed - overhead : 0;
+}
+
+/* Also called by the receiver and the interrupt */
+static void record(uint32_t value)
+{
+	if (skip > 0) {
+		skip--;
+	} else if (sample_count < IPC_BENCH_RUNS) {
+		samples[sample_count++] = value;
+	}
+}
+
+static void begin(uint32_t warmup)
+{
+	skip = warmup;
+	sample_count = 0;
+}
+
+static int compare(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+	return (x > y) - (x < y);
+}
+
+/* Turns the samples into a result and prints its row */
+static void finish(const char *fmt, ...)
+{
+	uint32_t n = sample_count;
+	if (n == 0 || result_count == IPC_BENCH_MAX_RESULTS) return;
+
+	ipc_bench_result_t *r = &results[result_count++];
+	va_list args;
+	va_start(args, fmt);
+	int len = vsnprintf(r->key, sizeof(r->key), fmt, args);
+	va_end(args);
+	if (len >= 0 && len < (int)sizeof(r->key))
+		snprintf(r->key + len, sizeof(r->key) - len, ".%s", bench_clock_unit());
+
+	uint64_t sum = 0;
+	qsort(samples, n, sizeof(samples[0]), compare);
+	for (uint32_t i = 0; i < n; i++) sum += samples[i];
+	r->mean = (uint32_t)(sum / n);
+	r->min = samples[0];
+	r->p50 = samples[n / 2];
+	r->p99 = samples[(n * 99) / 100];
+	r->max = samples[n - 1];
+
+	printf("%-34s %8lu %8lu %8lu %8lu %8lu %10lu\r\n", r->key, (unsigned long)r->mean,
+		   (unsigned long)r->min, (unsigned long)r->p50, (unsigned long)r->p99,
+		   (unsigned long)r->max, r->mean ? (unsigned long)(bench_clock_hz() / r->mean) : 0UL);
+}
+
+static void section(const char *title)
+{
+	printf("\r\n# %s\r\n", title);
+	printf("# %-32s %8s %8s %8s %8s %8s %10s\r\n", "case", "mean", "min", "p50", "p99", "max", "per_s");
+}
+
+// ===== CASES =====
+
+/* Give and take in this task: the cost of the primitive alone */
+static void run_local(const primitive_t *p)
+{
+	taker = bench_task;
+	if (p->setup) p->setup();
+	begin(IPC_BENCH_WARMUP);
+	for (int i = 0; i < IPC_BENCH_WARMUP + IPC_BENCH_RUNS; i++) {
+		uint32_t t0 = bench_clock_now();
+		p->give();
+		p->take();
+		record(since(t0));
+	}
+	if (p->teardown) p->teardown();
+}
+
+/* From the give (or the interrupt) until the blocked receiver runs */
+static void run_handoff(const primitive_t *p, bool from_isr)
+{
+	taker = receiver;
+	if (p->setup) p->setup();
+	current = p;
+	isr_primitive = p;
+	receiver_items = IPC_BENCH_WARMUP + IPC_BENCH_RUNS;
+	receiver_records = true;
+	begin(IPC_BENCH_WARMUP);
+	vTaskPrioritySet(receiver, PRIO_HIGH);
+	xTaskNotifyGiveIndexed(receiver, CTRL);		/* it runs and blocks in take() */
+
+	for (uint32_t i = 0; i < IPC_BENCH_WARMUP + IPC_BENCH_RUNS; i++) {
+		t_start = bench_clock_now();
+		if (from_isr) {
+			bench_trigger_isr();
+		} else {
+			p->give();
+		}
+	}
+	ulTaskNotifyTakeIndexed(CTRL, pdTRUE, portMAX_DELAY);
+	if (p->teardown) p->teardown();
+}
+
+/* From giving a mutex the receiver is blocked on until the receiver holds it.
+   While it waits this task runs at its priority (inheritance), and the give
+   drops it back, so the cost of the disinheritance is included. */
+static void run_contended(void)
+{
+	const primitive_t *p = &mutex_primitive;
+
+	p->setup();
+	current = p;
+	receiver_items = 1;
+	receiver_records = true;
+	begin(IPC_BENCH_WARMUP);
+	vTaskPrioritySet(receiver, PRIO_HIGH);
+
+	for (int i = 0; i < IPC_BENCH_WARMUP + IPC_BENCH_RUNS; i++) {
+		xSemaphoreTake(mutex, portMAX_DELAY);
+		xTaskNotifyGiveIndexed(receiver, CTRL);	/* it runs and blocks on the mutex */
+		configASSERT(uxTaskPriorityGet(NULL) == PRIO_HIGH);
+		t_start = bench_clock_now();
+		p->give();
+		ulTaskNotifyTakeIndexed(CTRL, pdTRUE, portMAX_DELAY);	/* given back */
+	}
+	p->teardown();
+}
+
+/* Until the interrupt handler runs: what every isr.* case includes */
+static void run_isr_entry(void)
+{
+	isr_primitive = NULL;
+	begin(IPC_BENCH_WARMUP);
+	for (int i = 0; i < IPC_BENCH_WARMUP + IPC_BENCH_RUNS; i++) {
+		t_start = bench_clock_now();
+		bench_trigger_isr();
+	}
+}
+
+/* BATCH_ITEMS through the queue to the receiver at this task's priority, per item */
+static void run_batch(void)
+{
+	queue_setup();
+	current = &queue_primitive;
+	receiver_items = BATCH_ITEMS;
+	receiver_records = false;
+	vTaskPrioritySet(receiver, PRIO_BENCH);
+	begin(1);
+
+	for (int run = 0; run < 1 + BATCH_RUNS; run++) {
+		uint32_t t0 = bench_clock_now();
+		xTaskNotifyGiveIndexed(receiver, CTRL);
+		for (int i = 0; i < BATCH_ITEMS; i++) queue_give();
+		ulTaskNotifyTakeIndexed(CTRL, pdTRUE, portMAX_DELAY);
+		record(since(t0) / BATCH_ITEMS);
+	}
+	queue_teardown();
+}
+
+static void run_op(void (*op)(void))
+{
+	begin(IPC_BENCH_WARMUP);
+	for (int i = 0; i < IPC_BENCH_WARMUP + IPC_BENCH_RUNS; i++) {
+		uint32_t t0 = bench_clock_now();
+		op();
+		record(since(t0));
+	}
+}
+
+static void mutex_op(void)
+{
+	xSemaphoreTake(mutex, portMAX_DELAY);
+	xSemaphoreGive(mutex);
+}
+
+static void create_queue(void)
+{
+	QueueHandle_t q = QUEUE_CREATE(QUEUE_DEPTH, sizeof(uint32_t));
+	configASSERT(q);
+	vQueueDelete(q);
+}
+
+static void create_semaphore(void)
+{
+	SemaphoreHandle_t s = SEMAPHORE_CREATE();
+	configASSERT(s);
+	vSemaphoreDelete(s);
+}
+
+static void create_event_group(void)
+{
+	EventGroupHandle_t g = GROUP_CREATE();
+	configASSERT(g);
+	vEventGroupDelete(g);
+}
+
+static void create_stream(void)
+{
+	StreamBufferHandle_t s = STREAM_CREATE(64, 1);
+	configASSERT(s);
+	vStreamBufferDelete(s);
+}
+
+// ===== TASKS =====
+
+static void receiver_handler(void *param)
+{
+	(void)param;
+	for (;;) {
+		ulTaskNotifyTakeIndexed(CTRL, pdTRUE, portMAX_DELAY);
+		const primitive_t *p = current;
+		for (uint32_t i = receiver_items; i > 0; i--) {
+			p->take();
+			if (receiver_records) record(since(t_start));
+			if (p->release) p->release();
+		}
+		xTaskNotifyGiveIndexed(bench_task, CTRL);
+	}
+}
+
+static void bench_handler(void *param)
+{
+	static const size_t queue_sizes[] = { 4, 16, 64, 256 };
+	static const size_t buffer_sizes[] = { 4, 64, 256 };
+	static const struct { const char *name; const primitive_t *p; } signals[] = {
+		{ "notify", &notify_primitive },
+		{ "semaphore", &semaphore_primitive },
+		{ "event_group", &group_primitive },
+	};
+	(void)param;
+
+	bench_port_init();
+	memset(tx, 0xA5, sizeof(tx));
+	overhead = UINT32_MAX;
+	for (int i = 0; i < 32; i++) {
+		uint32_t t0 = bench_clock_now();
+		uint32_t t = bench_clock_now() - t0;
+		if (t < overhead) overhead = t;
+	}
+
+	printf("\r\n# FreeRTOS IPC benchmark: %s at %lu Hz, %d runs per case, clock read %lu %s, %s task selection, %s objects\r\n",
+		   bench_clock_unit(), (unsigned long)bench_clock_hz(), IPC_BENCH_RUNS, (unsigned long)overhead,
+		   bench_clock_unit(), configUSE_PORT_OPTIMISED_TASK_SELECTION ? "port optimised" : "generic", ALLOCATION);
+
+	section("queue: send and receive by item size");
+	for (size_t i = 0; i < sizeof(queue_sizes) / sizeof(queue_sizes[0]); i++) {
+		item_size = queue_sizes[i];
+		run_local(&queue_primitive);
+		finish("queue.%uB.local", (unsigned)item_size);
+		run_handoff(&queue_primitive, false);
+		finish("queue.%uB.handoff", (unsigned)item_size);
+		run_batch();
+		finish("queue.%uB.batch", (unsigned)item_size);
+	}
+
+	section("signal: notification vs semaphore vs event group");
+	for (size_t i = 0; i < sizeof(signals) / sizeof(signals[0]); i++) {
+		run_local(signals[i].p);
+		finish("signal.%s.local", signals[i].name);
+		run_handoff(signals[i].p, false);
+		finish("signal.%s.handoff", signals[i].name);
+	}
+	mutex_setup();
+	run_op(mutex_op);
+	finish("signal.mutex.local");
+	mutex_teardown();
+	run_contended();
+	finish("signal.mutex.contended");
+
+	section("buffer: stream and message buffers by message size");
+	for (size_t i = 0; i < sizeof(buffer_sizes) / sizeof(buffer_sizes[0]); i++) {
+		item_size = buffer_sizes[i];
+		run_local(&stream_primitive);
+		finish("buffer.stream.%uB.local", (unsigned)item_size);
+		run_handoff(&stream_primitive, false);
+		finish("buffer.stream.%uB.handoff", (unsigned)item_size);
+		run_local(&message_primitive);
+		finish("buffer.message.%uB.local", (unsigned)item_size);
+		run_handoff(&message_primitive, false);
+		finish("buffer.message.%uB.handoff", (unsigned)item_size);
+	}
+
+	section("isr: interrupt to task handoff");
+	run_isr_entry();
+	finish("isr.entry");
+	run_handoff(&notify_primitive, true);
+	finish("isr.notify.handoff");
+	run_handoff(&semaphore_primitive, true);
+	finish("isr.semaphore.handoff");
+	item_size = 4;
+	run_handoff(&queue_primitive, true);
+	finish("isr.queue.4B.handoff");
+	run_handoff(&stream_primitive, true);
+	finish("isr.stream.4B.handoff");
+	run_handoff(&group_primitive, true);
+	finish("isr.event_group.handoff");
+
+	section("create: create and delete, " ALLOCATION " objects");
+	run_op(create_queue);
+	finish("create.queue.16x4B");
+	run_op(create_semaphore);
+	finish("create.semaphore");
+	run_op(create_event_group);
+	finish("create.event_group");
+	run_op(create_stream);
+	finish("create.stream.64B");
+
+	printf("# done\r\n");
+	bench_done();
+}
+
+void ipc_bench_start(void)
+{
+	BaseType_t status;
+
+	status = TASK_CREATE(0, bench_handler, "bench", BENCH_STACK, PRIO_BENCH, &bench_task);
+	configASSERT(status == pdPASS);
+	status = TASK_CREATE(1, receiver_handler, "receiver", RECEIVER_STACK, PRIO_HIGH, &receiver);
+	configASSERT(status == pdPASS);
+}
+
+void ipc_bench_isr(void)
+{
+	BaseType_t woken = pdFALSE;
+	const primitive_t *p = isr_primitive;
+
+	if (p == NULL) {
+		record(since(t_start));
+		return;
+	}
+	p->give_from_isr(&woken);
+	portYIELD_FROM_ISR(woken);
+}
+
+int ipc_bench_results(const ipc_bench_result_t **out)
+{
+	*out = results;
+	return result_count;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file board.c
+ * @brief 006_freeRTOS_3Led_button_task on the simulated board.
+ *
+ * Does what main.c does after the clock setup. The LEDs start off, B1
+ * (PC13) is released until the script presses it:
+ *
+ *   2.0  gpio C13 0
+ *   2.2  gpio C13 1
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#include "main.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "sim.h"
+
+void sim_app_start(void) {
+    // MX_GPIO_Init()
+    HAL_GPIO_WritePin(GPIOA, LD1_Pin | LD2_Pin | LD3_Pin | LD4_Pin, GPIO_PIN_RESET);
+
+    led_tasks_create();
+    vTaskStartScheduler();
+}
+
+void sim_app_idle(uint64_t idle_us) {
+    (void)idle_us;
+}
+
+void Error_Handler(void) {
+    sim_fail("Error_Handler");
+}
@@ -0,0 +1,72 @@
+/**
+ * @file FreeRTOSConfig.h
+ * @brief Kernel settings of 007_freeRTOS_Queues for the host simulation.
+ *
+ * Same as Core/Inc/FreeRTOSConfig.h of the app, except that run time is
+ * counted in virtual microseconds instead of DWT cycles, and the tickless
+ * idle of power_tickless.c is replaced by the simulation's (sim_config.h).
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdint.h>
+
+extern uint32_t SystemCoreClock;
+void profiler_timer_init(void);
+extern volatile uint32_t profiler_switches[];
+uint64_t sim_now_us(void);
+
+#define configUSE_PREEMPTION 1
+#define configUSE_TICK_HOOK 0
+#define configCPU_CLOCK_HZ (SystemCoreClock)
+#define configTICK_RATE_HZ ((TickType_t)1000)
+#define configMAX_PRIORITIES (5)
+#define configMINIMAL_STACK_SIZE ((unsigned short)130)
+#define configMAX_TASK_NAME_LEN (10)
+#define configUSE_TRACE_FACILITY 1
+#define configUSE_16_BIT_TICKS 0
+#define configIDLE_SHOULD_YIELD 1
+#define configUSE_MUTEXES 1
+#define configQUEUE_REGISTRY_SIZE 8
+#define configCHECK_FOR_STACK_OVERFLOW 0
+#define configUSE_RECURSIVE_MUTEXES 1
+#define configUSE_MALLOC_FAILED_HOOK 0
+#define configUSE_APPLICATION_TASK_TAG 0
+#define configUSE_COUNTING_SEMAPHORES 1
+#define configGENERATE_RUN_TIME_STATS 1
+#define configSUPPORT_STATIC_ALLOCATION 1
+#define configSUPPORT_DYNAMIC_ALLOCATION 0
+#define configKERNEL_PROVIDED_STATIC_MEMORY 1
+
+#define PROFILER_MAX_TASKS 16 /* power of two */
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() profiler_timer_init()
+#define portGET_RUN_TIME_COUNTER_VALUE() ((uint32_t)sim_now_us())
+#define traceTASK_SWITCHED_IN() profiler_switches[pxCurrentTCB->uxTCBNumber & (PROFILER_MAX_TASKS - 1)]++
+
+#define configUSE_CO_ROUTINES 0
+#define configMAX_CO_ROUTINE_PRIORITIES (2)
+
+#define configUSE_TIMERS 1
+#define configTIMER_TASK_PRIORITY (2)
+#define configTIMER_QUEUE_LENGTH 10
+#define configTIMER_TASK_STACK_DEPTH (configMINIMAL_STACK_SIZE * 2)
+
+#define INCLUDE_vTaskPrioritySet 1
+#define INCLUDE_uxTaskPriorityGet 1
+#define INCLUDE_vTaskDelete 1
+#define INCLUDE_vTaskCleanUpResources 1
+#define INCLUDE_vTaskSuspend 1
+#define INCLUDE_vTaskDelayUntil 1
+#define INCLUDE_vTaskDelay 1
+#define INCLUDE_xTaskGetIdleTaskHandle 1
+#define INCLUDE_pxTaskGetStackStart 1
+#define INCLUDE_uxTaskGetStackHighWaterMark 1
+
+#include "sim_config.h"
+
+#endif /* FREERTOS_CONFIG_H */
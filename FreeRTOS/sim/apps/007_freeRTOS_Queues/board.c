@@ -0,0 +1,84 @@
+/**
+ * @file board.c
+ * @brief 007_freeRTOS_Queues on the simulated board.
+ *
+ * Holds the globals of main.c and does what its main() does after the
+ * peripheral setup. power_tickless.c is not built: stop mode and the RTC
+ * wake-up timer are not simulated, so the menu's stop lock is a no-op and
+ * idle time is accounted as sleep in the profiler's power line.
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#include "main.h"
+#include "rtos_objects.h"
+#include "sim.h"
+
+RTC_HandleTypeDef hrtc;
+UART_HandleTypeDef huart2;
+
+xTaskHandle handle_menu_task;
+xTaskHandle handle_cmd_task;
+xTaskHandle handle_print_task;
+xTaskHandle handle_led_task;
+xTaskHandle handle_rtc_task;
+xTaskHandle handle_profiler_task;
+
+QueueHandle_t q_data;
+QueueHandle_t q_print;
+TimerHandle_t handle_led_timer[4];
+TimerHandle_t handle_menu_idle_timer;
+
+volatile uint8_t user_data;
+state_t curr_state = sMainMenu;
+
+power_policy_t power;
+static uint64_t accounted_us;
+
+void sim_app_start(void) {
+    // MX_USART2_UART_Init() and MX_RTC_Init()
+    huart2.Instance = USART2;
+    huart2.Init.BaudRate = 115200;
+    hrtc.Instance = RTC;
+    hrtc.Init.HourFormat = RTC_HOURFORMAT_24;
+    hrtc.Init.AsynchPrediv = 7;
+    hrtc.Init.SynchPrediv = 3999;
+
+    rtos_objects_create();
+    rtos_objects_start();
+    rtos_objects_report();
+    time_service_init();
+
+    static const power_state_info_t states[POWER_STATE_COUNT];
+    power_policy_init(&power, states);
+
+    HAL_UART_Receive_IT(&huart2, (uint8_t *)&user_data, 1);
+    vTaskStartScheduler();
+}
+
+void sim_app_idle(uint64_t idle_us) {
+    uint64_t now = sim_now_us();
+
+    power_policy_account(&power, POWER_RUN, (uint32_t)(now - accounted_us));
+    power_policy_account(&power, POWER_SLEEP, (uint32_t)idle_us);
+    accounted_us = now + idle_us;
+}
+
+// stm32f4xx_it.c
+void TIM2_IRQHandler(void) {
+    time_service_irq();
+}
+
+// power_tickless.c
+void power_menu_activity_from_isr(void) {
+}
+
+void menu_idle_callback(TimerHandle_t xTimer) {
+    (void)xTimer;
+}
+
+void Error_Handler(void) {
+    sim_fail("Error_Handler");
+}
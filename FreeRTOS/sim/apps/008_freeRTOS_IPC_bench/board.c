@@ -0,0 +1,87 @@
+/**
+ * @file board.c
+ * @brief 008_freeRTOS_IPC_bench on the simulated board.
+ *
+ * ipc_bench.h's port on the host: the clock is the host's monotonic clock
+ * in nanoseconds, which runs while the virtual one stands still, and the
+ * software interrupt runs at once through the port. The results go into
+ * the report and, with -o, the summary, as "<case> <mean>" and
+ * "<case>.p99 <p99>":
+ *
+ *   sim_008 -q -o bench.txt scripts/008_bench.txt
+ *
+ * As on the board, bench_done() suspends the benchmark task. The run ends
+ * once the idle task has the core, so it shows in the report like the rest.
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ipc_bench.h"
+#include "sim.h"
+
+static bool done;
+
+void sim_app_start(void) {
+    ipc_bench_start();
+    vTaskStartScheduler();
+}
+
+void sim_app_idle(uint64_t idle_us) {
+    (void)idle_us;
+    if (done) {
+        sim_finish("benchmark done");
+    }
+}
+
+void sim_app_report(void (*metric)(const char *key, double value)) {
+    const ipc_bench_result_t *results;
+    int n = ipc_bench_results(&results);
+    char key[IPC_BENCH_KEY_LEN + 8];
+
+    for (int i = 0; i < n; i++) {
+        metric(results[i].key, results[i].mean);
+        snprintf(key, sizeof(key), "%s.p99", results[i].key);
+        metric(key, results[i].p99);
+    }
+}
+
+// ===== BENCH PORT =====
+
+void bench_port_init(void) {
+}
+
+uint32_t bench_clock_now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+uint32_t bench_clock_hz(void) {
+    return 1000000000u;
+}
+
+const char *bench_clock_unit(void) {
+    return "ns";
+}
+
+static void bench_isr(void *arg) {
+    (void)arg;
+    ipc_bench_isr();
+}
+
+void bench_trigger_isr(void) {
+    port_isr(bench_isr, NULL);
+    port_service();
+}
+
+void bench_done(void) {
+    done = true;
+    vTaskSuspend(NULL);
+}
@@ -0,0 +1,59 @@
+/**
+ * @file FreeRTOSConfig.h
+ * @brief Kernel settings of 016_Hotel_system_FreeRTOS for the host simulation.
+ *
+ * The settings of the app's sdkconfig that its code depends on: a 100 Hz
+ * tick, ESP-IDF's 25 priorities, queue sets, and the static objects of
+ * rtos_objects.c. The ESP32 runs the tasks on two cores; here there is
+ * one, which the pipeline does not notice, since every task spends its
+ * time blocked.
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdint.h>
+
+extern uint32_t SystemCoreClock;
+
+#define configUSE_PREEMPTION 1
+#define configUSE_TICK_HOOK 0
+#define configCPU_CLOCK_HZ (SystemCoreClock)
+#define configTICK_RATE_HZ ((TickType_t)100)
+#define configMAX_PRIORITIES (25)
+#define configMINIMAL_STACK_SIZE ((unsigned short)384)
+#define configMAX_TASK_NAME_LEN (16)
+#define configUSE_TRACE_FACILITY 1
+#define configUSE_16_BIT_TICKS 0
+#define configIDLE_SHOULD_YIELD 1
+#define configUSE_MUTEXES 1
+#define configUSE_COUNTING_SEMAPHORES 1
+#define configUSE_QUEUE_SETS 1
+#define configQUEUE_REGISTRY_SIZE 0
+#define configCHECK_FOR_STACK_OVERFLOW 0
+#define configUSE_MALLOC_FAILED_HOOK 0
+#define configGENERATE_RUN_TIME_STATS 0
+
+#define configSUPPORT_STATIC_ALLOCATION 1
+#define configSUPPORT_DYNAMIC_ALLOCATION 0
+#define configKERNEL_PROVIDED_STATIC_MEMORY 1
+
+#define configUSE_CO_ROUTINES 0
+#define configUSE_TIMERS 0
+#define configTIMER_TASK_PRIORITY (2)
+#define configTIMER_QUEUE_LENGTH 10
+#define configTIMER_TASK_STACK_DEPTH (configMINIMAL_STACK_SIZE * 2)
+
+#define INCLUDE_vTaskDelay 1
+#define INCLUDE_vTaskSuspend 1
+#define INCLUDE_xTaskGetIdleTaskHandle 1
+#define INCLUDE_uxTaskGetStackHighWaterMark 1
+#define INCLUDE_xTaskGetSchedulerState 1
+
+#include "sim_config.h"
+
+#endif /* FREERTOS_CONFIG_H */
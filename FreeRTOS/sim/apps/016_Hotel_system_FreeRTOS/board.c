@@ -0,0 +1,51 @@
+/**
+ * @file board.c
+ * @brief 016_Hotel_system_FreeRTOS on the simulated board.
+ *
+ * The ESP32 app runs unchanged: main/main.c, completion.c and the shared
+ * rtos_objects.c, on the same kernel API. Its "freertos/<header>" includes
+ * resolve to the plain kernel headers through the one-line shims in
+ * freertos/. ESP-IDF calls app_main() from a task once the scheduler is
+ * running; here it runs before, which is the same for an app_main() that
+ * only creates objects and tasks and returns.
+ *
+ * There are no inputs: the reception task makes the arrivals. The run
+ * ends at the script's end, e.g. after an hour:
+ *
+ *   sim_016 -q -o hotel.txt scripts/016_hotel.txt
+ *
+ * sim_016_busy is the same app with a customer every 5 s instead of 8 s,
+ * more than a waiter that waits for each order could serve.
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#include "hotel.h"
+#include "sim.h"
+
+extern int customerCounter;
+extern int paidCustomers;
+extern completion_pool_t orderTokens;
+
+void app_main(void);
+
+void sim_app_start(void) {
+    app_main();
+    vTaskStartScheduler();
+}
+
+void sim_app_idle(uint64_t idle_us) {
+    (void)idle_us;
+}
+
+void sim_app_report(void (*metric)(const char *key, double value)) {
+    double hours = sim_now_us() / 3600e6;
+
+    metric("hotel.arrived", customerCounter - 1);
+    metric("hotel.paid", paidCustomers);
+    metric("hotel.paid_per_hour", hours > 0 ? paidCustomers / hours : 0);
+    metric("hotel.stale_replies", orderTokens.stale_replies);
+    metric("hotel.tables_free", uxSemaphoreGetCount(availableTables));
+}
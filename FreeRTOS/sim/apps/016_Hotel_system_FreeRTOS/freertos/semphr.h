@@ -0,0 +1 @@
+#include <semphr.h>
@@ -0,0 +1,407 @@
+/**
+ * @file sim_hal.c
+ * @brief HAL shim of the simulation: GPIO, USART2, RTC and TIM2 in virtual time.
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "sim.h"
+
+#define SCRIPT_BAUD 115200   // the script's bytes arrive at this rate
+#define TIMER_CLOCK_HZ 84000000u
+#define IRQ_COUNT 100
+#define DAY_US (86400ULL * 1000000)
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME 16777619u
+
+uint32_t SystemCoreClock = 84000000;
+CoreDebug_Type sim_core_debug;
+DWT_Type sim_dwt;
+RCC_TypeDef sim_rcc = {.CFGR = RCC_CFGR_PPRE1_DIV2};
+USART_TypeDef sim_usart2;
+RTC_TypeDef sim_rtc;
+
+// Inputs idle high, like B1 with its pull-up
+GPIO_TypeDef sim_gpio[8] = {
+    {.IDR = 0xFFFF}, {.IDR = 0xFFFF}, {.IDR = 0xFFFF}, {.IDR = 0xFFFF},
+    {.IDR = 0xFFFF}, {.IDR = 0xFFFF}, {.IDR = 0xFFFF}, {.IDR = 0xFFFF},
+};
+static uint32_t gpio_edges[8][16];
+
+static bool irq_enabled[IRQ_COUNT];
+
+static UART_HandleTypeDef *rx_huart;
+static uint32_t tx_bytes, rx_bytes, rx_overruns;
+static uint32_t tx_hash = FNV_OFFSET;
+
+static int64_t rtc_base_us; // calendar at rtc_base_at, us since 2000
+static uint64_t rtc_base_at;
+static int32_t rtc_error_ppb;
+static uint32_t rtc_bkp[RTC_BKP_NUMBER];
+static int64_t rtc_shadow_us; // calendar frozen by GetTime until GetDate
+static bool rtc_shadow;
+
+static TIM_TypeDef tim2;
+static bool tim2_running;
+static uint64_t tim2_start_us;
+static uint64_t tim2_wraps;
+
+static const uint8_t days_in_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+// ===== CORE =====
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority) {
+    (void)IRQn;
+    (void)PreemptPriority;
+    (void)SubPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn) {
+    irq_enabled[IRQn] = true;
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn) {
+    irq_enabled[IRQn] = false;
+}
+
+uint32_t HAL_GetTick(void) {
+    return (uint32_t)(sim_now_us() / 1000);
+}
+
+// A busy wait on the board, too
+void HAL_Delay(uint32_t Delay) {
+    sim_busy_us(Delay * 1000);
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void) {
+    return SystemCoreClock / 2;
+}
+
+// ===== GPIO =====
+
+static void gpio_changed(GPIO_TypeDef *port, uint32_t old) {
+    uint32_t changed = (old ^ port->ODR) & 0xFFFF;
+    int p = (int)(port - sim_gpio);
+
+    for (int pin = 0; changed; pin++, changed >>= 1) {
+        if (!(changed & 1)) {
+            continue;
+        }
+        gpio_edges[p][pin]++;
+        if (sim_gpio_log) {
+            char line[32];
+            int len = snprintf(line, sizeof(line), "P%c%d=%d\n", 'A' + p, pin, (int)(port->ODR >> pin & 1));
+            sim_console("gpio", line, (uint32_t)len);
+        }
+    }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin) {
+    return (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+    uint32_t old = GPIOx->ODR;
+
+    GPIOx->ODR = PinState == GPIO_PIN_SET ? old | GPIO_Pin : old & ~(uint32_t)GPIO_Pin;
+    gpio_changed(GPIOx, old);
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin) {
+    uint32_t old = GPIOx->ODR;
+
+    GPIOx->ODR = old ^ GPIO_Pin;
+    gpio_changed(GPIOx, old);
+}
+
+static void gpio_input_isr(void *arg) {
+    uintptr_t v = (uintptr_t)arg;
+    GPIO_TypeDef *port = &sim_gpio[v >> 8 & 7];
+    uint32_t pin = 1u << (v >> 4 & 15);
+
+    port->IDR = (v & 1) ? port->IDR | pin : port->IDR & ~pin;
+}
+
+// ===== UART =====
+
+static uint32_t byte_us(uint32_t baud) {
+    // Start, 8 data and stop bit
+    return (10u * 1000000u + baud / 2) / (baud ? baud : SCRIPT_BAUD);
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout) {
+    (void)Timeout;
+    sim_console("uart", (const char *)pData, Size);
+    for (uint16_t i = 0; i < Size; i++) {
+        tx_hash = (tx_hash ^ pData[i]) * FNV_PRIME;
+    }
+    tx_bytes += Size;
+    sim_busy_us(Size * byte_us(huart->Init.BaudRate));
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size) {
+    if (rx_huart != NULL) {
+        return HAL_BUSY;
+    }
+    if (pData == NULL || Size == 0) {
+        return HAL_ERROR;
+    }
+    huart->pRxBuffPtr = pData;
+    huart->RxXferSize = Size;
+    huart->RxXferCount = Size;
+    rx_huart = huart;
+    return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
+    (void)huart;
+}
+
+// USART2 interrupt for one received byte
+static void uart_rx_isr(void *arg) {
+    UART_HandleTypeDef *huart = rx_huart;
+
+    rx_bytes++;
+    if (huart == NULL) {
+        rx_overruns++; // nobody listening: the byte is lost (ORE)
+        return;
+    }
+    *huart->pRxBuffPtr++ = (uint8_t)(uintptr_t)arg;
+    if (--huart->RxXferCount == 0) {
+        rx_huart = NULL;
+        HAL_UART_RxCpltCallback(huart);
+    }
+}
+
+// ===== RTC =====
+
+static int32_t calr_ppb(uint32_t calr) {
+    int32_t pulses = ((calr & RTC_CALR_CALP) ? 512 : 0) - (int32_t)(calr & RTC_CALR_CALM);
+
+    // Pulses per 2^20 RTCCLK cycles (32 s at 32768 Hz)
+    return (int32_t)((int64_t)pulses * 1000000000 / (1 << 20));
+}
+
+static int64_t rtc_now_us(void) {
+    int64_t elapsed = (int64_t)(sim_now_us() - rtc_base_at);
+    int64_t ppb = (int64_t)rtc_error_ppb + calr_ppb(sim_rtc.CALR);
+
+    return rtc_base_us + elapsed + (int64_t)((__int128)elapsed * ppb / 1000000000);
+}
+
+static void rtc_rebase(int64_t calendar_us) {
+    rtc_base_us = calendar_us;
+    rtc_base_at = sim_now_us();
+    rtc_shadow = false;
+}
+
+static bool leap(uint32_t year) {
+    return year % 4 == 0;
+}
+
+static uint32_t month_days(uint32_t year, uint32_t month) {
+    return month == 2 && leap(year) ? 29 : days_in_month[month - 1];
+}
+
+static uint32_t days_since_2000(uint32_t year, uint32_t month, uint32_t day) {
+    uint32_t days = day - 1;
+
+    for (uint32_t y = 0; y < year; y++) {
+        days += leap(y) ? 366 : 365;
+    }
+    for (uint32_t m = 1; m < month; m++) {
+        days += month_days(year, m);
+    }
+    return days;
+}
+
+HAL_StatusTypeDef HAL_RTC_GetTime(RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTime, uint32_t Format) {
+    uint32_t prediv_s = hrtc->Init.SynchPrediv;
+    (void)Format;
+
+    rtc_shadow_us = rtc_now_us();
+    rtc_shadow = true;
+
+    uint64_t secs = (uint64_t)rtc_shadow_us / 1000000 % 86400;
+    uint64_t steps = (uint64_t)rtc_shadow_us % 1000000 * (prediv_s + 1) / 1000000;
+    sTime->Hours = (uint8_t)(secs / 3600);
+    sTime->Minutes = (uint8_t)(secs / 60 % 60);
+    sTime->Seconds = (uint8_t)(secs % 60);
+    sTime->TimeFormat = RTC_HOURFORMAT12_AM;
+    sTime->SubSeconds = prediv_s - (uint32_t)steps; // counts down
+    sTime->SecondFraction = prediv_s;
+    sTime->DayLightSaving = RTC_DAYLIGHTSAVING_NONE;
+    sTime->StoreOperation = RTC_STOREOPERATION_RESET;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_GetDate(RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t Format) {
+    int64_t us = rtc_shadow ? rtc_shadow_us : rtc_now_us();
+    uint32_t days = (uint32_t)((uint64_t)us / DAY_US);
+    uint32_t year = 0, month = 1;
+    (void)hrtc;
+    (void)Format;
+
+    rtc_shadow = false;
+    sDate->WeekDay = (uint8_t)((days + 5) % 7 + 1); // 2000-01-01 was a Saturday
+    while (days >= (leap(year) ? 366u : 365u)) {
+        days -= leap(year) ? 366 : 365;
+        year++;
+    }
+    while (days >= month_days(year, month)) {
+        days -= month_days(year, month);
+        month++;
+    }
+    sDate->Year = (uint8_t)year;
+    sDate->Month = (uint8_t)month;
+    sDate->Date = (uint8_t)(days + 1);
+    return HAL_OK;
+}
+
+// Setting the time also restarts the sub-second prescaler
+HAL_StatusTypeDef HAL_RTC_SetTime(RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTime, uint32_t Format) {
+    (void)hrtc;
+    (void)Format;
+    if (sTime->Hours > 23 || sTime->Minutes > 59 || sTime->Seconds > 59) {
+        return HAL_ERROR;
+    }
+    int64_t day = rtc_now_us() / (int64_t)DAY_US * (int64_t)DAY_US;
+    rtc_rebase(day + (int64_t)(sTime->Hours * 3600u + sTime->Minutes * 60u + sTime->Seconds) * 1000000);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_SetDate(RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t Format) {
+    (void)hrtc;
+    (void)Format;
+    if (sDate->Year > 99 || sDate->Month < 1 || sDate->Month > 12 || sDate->Date < 1 ||
+        sDate->Date > month_days(sDate->Year, sDate->Month)) {
+        return HAL_ERROR;
+    }
+    int64_t time_of_day = rtc_now_us() % (int64_t)DAY_US;
+    rtc_rebase((int64_t)days_since_2000(sDate->Year, sDate->Month, sDate->Date) * (int64_t)DAY_US + time_of_day);
+    return HAL_OK;
+}
+
+uint32_t HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister) {
+    (void)hrtc;
+    return rtc_bkp[BackupRegister % RTC_BKP_NUMBER];
+}
+
+void HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister, uint32_t Data) {
+    (void)hrtc;
+    rtc_bkp[BackupRegister % RTC_BKP_NUMBER] = Data;
+}
+
+HAL_StatusTypeDef HAL_RTCEx_SetSmoothCalib(RTC_HandleTypeDef *hrtc, uint32_t SmoothCalibPeriod,
+                                           uint32_t SmoothCalibPlusPulses, uint32_t SmoothCalibMinusPulsesValue) {
+    (void)hrtc;
+    (void)SmoothCalibPeriod;
+    rtc_rebase(rtc_now_us());
+    sim_rtc.CALR = SmoothCalibPlusPulses | (SmoothCalibMinusPulsesValue & RTC_CALR_CALM);
+    return HAL_OK;
+}
+
+static void rtc_error_isr(void *arg) {
+    rtc_rebase(rtc_now_us());
+    rtc_error_ppb = (int32_t)(intptr_t)arg;
+}
+
+// ===== TIM2 =====
+
+static uint64_t tim2_ticks_to_us(uint64_t ticks) {
+    return (uint64_t)((unsigned __int128)ticks * (tim2.PSC + 1) * 1000000 / TIMER_CLOCK_HZ);
+}
+
+static void tim2_update_isr(void *arg) {
+    (void)arg;
+    TIM_TypeDef *tim = sim_tim2();
+
+    if (tim2_running) {
+        sim_at(tim2_start_us + tim2_ticks_to_us((tim2_wraps + 1) << 32), tim2_update_isr, NULL);
+        if ((tim->DIER & TIM_DIER_UIE) && (tim->SR & TIM_SR_UIF) && irq_enabled[TIM2_IRQn]) {
+            TIM2_IRQHandler();
+        }
+    }
+}
+
+TIM_TypeDef *sim_tim2(void) {
+    if (!(tim2.CR1 & TIM_CR1_CEN)) {
+        tim2_running = false;
+        return &tim2;
+    }
+    if (!tim2_running) {
+        tim2_running = true;
+        tim2_start_us = sim_now_us();
+        tim2_wraps = 0;
+        sim_at(tim2_start_us + tim2_ticks_to_us(1ULL << 32), tim2_update_isr, NULL);
+    }
+
+    uint64_t ticks = (uint64_t)((unsigned __int128)(sim_now_us() - tim2_start_us) * TIMER_CLOCK_HZ / 1000000 /
+                                (tim2.PSC + 1));
+    tim2.CNT = (uint32_t)ticks;
+    if ((ticks >> 32) > tim2_wraps) {
+        tim2_wraps = ticks >> 32;
+        tim2.SR |= TIM_SR_UIF;
+    }
+    return &tim2;
+}
+
+__attribute__((weak)) void TIM2_IRQHandler(void) {
+}
+
+// ===== SCRIPT =====
+
+bool sim_hal_command(uint64_t at_us, const char *cmd, const char *args) {
+    if (strcmp(cmd, "uart") == 0) {
+        uint32_t step = byte_us(SCRIPT_BAUD);
+        for (size_t i = 0; args[i]; i++) {
+            sim_at(at_us + i * step, uart_rx_isr, (void *)(uintptr_t)(uint8_t)args[i]);
+        }
+        return true;
+    }
+    if (strcmp(cmd, "gpio") == 0) {
+        char port;
+        unsigned pin, level;
+        if (sscanf(args, "%c%u %u", &port, &pin, &level) != 3 || port < 'A' || port > 'H' || pin > 15 ||
+            level > 1) {
+            return false;
+        }
+        sim_at(at_us, gpio_input_isr, (void *)(uintptr_t)((unsigned)(port - 'A') << 8 | pin << 4 | level));
+        return true;
+    }
+    if (strcmp(cmd, "rtc_ppm") == 0) {
+        char *end;
+        double ppm = strtod(args, &end);
+        if (end == args || ppm < -100000 || ppm > 100000) {
+            return false;
+        }
+        sim_at(at_us, rtc_error_isr, (void *)(intptr_t)(int32_t)(ppm * 1000));
+        return true;
+    }
+    return false;
+}
+
+// ===== REPORT =====
+
+void sim_hal_report(void (*metric)(const char *key, double value)) {
+    char key[32];
+
+    metric("uart.tx_bytes", tx_bytes);
+    metric("uart.rx_bytes", rx_bytes);
+    metric("uart.rx_overruns", rx_overruns);
+    metric("uart.tx_hash", tx_hash);
+    for (int p = 0; p < 8; p++) {
+        for (int pin = 0; pin < 16; pin++) {
+            if (gpio_edges[p][pin]) {
+                snprintf(key, sizeof(key), "gpio.P%c%d.edges", 'A' + p, pin);
+                metric(key, gpio_edges[p][pin]);
+            }
+        }
+    }
+}
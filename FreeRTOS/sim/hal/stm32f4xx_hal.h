@@ -0,0 +1,254 @@
+/**
+ * @file stm32f4xx_hal.h
+ * @brief The part of the STM32F4 HAL and CMSIS the apps use, for the host.
+ *
+ * Stands in for the Cube HAL in the simulation build (sim_hal.c):
+ *   - GPIO ports A to H; inputs idle high and are driven by the script.
+ *   - USART2: transmit prints the bytes and takes their time on the line,
+ *     receive takes the script's bytes at the same rate.
+ *   - RTC: calendar, backup registers and smooth calibration, on a clock
+ *     whose error the script sets.
+ *   - TIM2 as a free-running counter at its prescaled rate, RCC and NVIC as
+ *     far as time_service.c needs them.
+ *   - PRIMASK and the DWT cycle counter.
+ * Only the binary format of the RTC is supported.
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#ifndef STM32F4XX_HAL_H
+#define STM32F4XX_HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __IO volatile
+#define UNUSED(x) ((void)(x))
+#define HAL_MAX_DELAY 0xFFFFFFFFU
+
+typedef enum { HAL_OK = 0x00U, HAL_ERROR = 0x01U, HAL_BUSY = 0x02U, HAL_TIMEOUT = 0x03U } HAL_StatusTypeDef;
+
+typedef enum { TIM2_IRQn = 28, USART2_IRQn = 38, RTC_WKUP_IRQn = 3 } IRQn_Type;
+
+extern uint32_t SystemCoreClock;
+
+// ===== CORE =====
+
+uint32_t port_get_primask(void);
+void port_set_primask(uint32_t primask);
+
+#define __get_PRIMASK() port_get_primask()
+#define __set_PRIMASK(x) port_set_primask(x)
+#define __disable_irq() port_set_primask(1)
+#define __enable_irq() port_set_primask(0)
+#define __NOP()
+#define __DSB()
+#define __ISB()
+
+typedef struct {
+    __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+    __IO uint32_t CTRL;
+    __IO uint32_t CYCCNT;
+} DWT_Type;
+
+extern CoreDebug_Type sim_core_debug;
+extern DWT_Type sim_dwt;
+#define CoreDebug (&sim_core_debug)
+#define DWT (&sim_dwt)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk (1UL << 0)
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+// ===== RCC =====
+
+typedef struct {
+    __IO uint32_t CFGR;
+} RCC_TypeDef;
+
+extern RCC_TypeDef sim_rcc;
+#define RCC (&sim_rcc)
+#define RCC_CFGR_PPRE1 (0x7UL << 10)
+#define RCC_CFGR_PPRE1_DIV1 0x00000000UL
+#define RCC_CFGR_PPRE1_DIV2 (0x4UL << 10)
+
+#define __HAL_RCC_TIM2_CLK_ENABLE() ((void)0)
+#define __HAL_RCC_GPIOA_CLK_ENABLE() ((void)0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE() ((void)0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE() ((void)0)
+
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+
+// ===== GPIO =====
+
+typedef struct {
+    __IO uint32_t IDR;
+    __IO uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+
+extern GPIO_TypeDef sim_gpio[8];
+#define GPIOA (&sim_gpio[0])
+#define GPIOB (&sim_gpio[1])
+#define GPIOC (&sim_gpio[2])
+#define GPIOD (&sim_gpio[3])
+#define GPIOE (&sim_gpio[4])
+#define GPIOF (&sim_gpio[5])
+#define GPIOG (&sim_gpio[6])
+#define GPIOH (&sim_gpio[7])
+
+#define GPIO_PIN_0 ((uint16_t)0x0001)
+#define GPIO_PIN_1 ((uint16_t)0x0002)
+#define GPIO_PIN_2 ((uint16_t)0x0004)
+#define GPIO_PIN_3 ((uint16_t)0x0008)
+#define GPIO_PIN_4 ((uint16_t)0x0010)
+#define GPIO_PIN_5 ((uint16_t)0x0020)
+#define GPIO_PIN_6 ((uint16_t)0x0040)
+#define GPIO_PIN_7 ((uint16_t)0x0080)
+#define GPIO_PIN_8 ((uint16_t)0x0100)
+#define GPIO_PIN_9 ((uint16_t)0x0200)
+#define GPIO_PIN_10 ((uint16_t)0x0400)
+#define GPIO_PIN_11 ((uint16_t)0x0800)
+#define GPIO_PIN_12 ((uint16_t)0x1000)
+#define GPIO_PIN_13 ((uint16_t)0x2000)
+#define GPIO_PIN_14 ((uint16_t)0x4000)
+#define GPIO_PIN_15 ((uint16_t)0x8000)
+#define GPIO_PIN_All ((uint16_t)0xFFFF)
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+// ===== UART =====
+
+typedef struct {
+    __IO uint32_t SR;
+} USART_TypeDef;
+
+extern USART_TypeDef sim_usart2;
+#define USART2 (&sim_usart2)
+
+typedef struct {
+    uint32_t BaudRate;
+} UART_InitTypeDef;
+
+typedef struct __UART_HandleTypeDef {
+    USART_TypeDef *Instance;
+    UART_InitTypeDef Init;
+    uint8_t *pRxBuffPtr;
+    uint16_t RxXferSize;
+    __IO uint16_t RxXferCount;
+} UART_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart);
+
+// ===== RTC =====
+
+typedef struct {
+    __IO uint32_t CALR;
+} RTC_TypeDef;
+
+extern RTC_TypeDef sim_rtc;
+#define RTC (&sim_rtc)
+#define RTC_CALR_CALP (1UL << 15)
+#define RTC_CALR_CALW8 (1UL << 14)
+#define RTC_CALR_CALW16 (1UL << 13)
+#define RTC_CALR_CALM 0x1FFUL
+
+typedef struct {
+    uint32_t HourFormat;
+    uint32_t AsynchPrediv;
+    uint32_t SynchPrediv;
+} RTC_InitTypeDef;
+
+typedef struct {
+    RTC_TypeDef *Instance;
+    RTC_InitTypeDef Init;
+} RTC_HandleTypeDef;
+
+typedef struct {
+    uint8_t Hours;
+    uint8_t Minutes;
+    uint8_t Seconds;
+    uint8_t TimeFormat;
+    uint32_t SubSeconds;
+    uint32_t SecondFraction;
+    uint32_t DayLightSaving;
+    uint32_t StoreOperation;
+} RTC_TimeTypeDef;
+
+typedef struct {
+    uint8_t WeekDay;
+    uint8_t Month;
+    uint8_t Date;
+    uint8_t Year;
+} RTC_DateTypeDef;
+
+#define RTC_FORMAT_BIN 0x00000000U
+#define RTC_HOURFORMAT_24 0x00000000U
+#define RTC_HOURFORMAT12_AM ((uint8_t)0x00)
+#define RTC_DAYLIGHTSAVING_NONE 0x00000000U
+#define RTC_STOREOPERATION_RESET 0x00000000U
+#define RTC_SMOOTHCALIB_PERIOD_32SEC 0x00000000U
+#define RTC_SMOOTHCALIB_PLUSPULSES_SET RTC_CALR_CALP
+#define RTC_SMOOTHCALIB_PLUSPULSES_RESET 0x00000000U
+
+#define RTC_BKP_DR0 0x00000000U
+#define RTC_BKP_DR1 0x00000001U
+#define RTC_BKP_DR2 0x00000002U
+#define RTC_BKP_DR3 0x00000003U
+#define RTC_BKP_NUMBER 20
+
+HAL_StatusTypeDef HAL_RTC_GetTime(RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTime, uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_GetDate(RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_SetTime(RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTime, uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_SetDate(RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t Format);
+uint32_t HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister);
+void HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister, uint32_t Data);
+HAL_StatusTypeDef HAL_RTCEx_SetSmoothCalib(RTC_HandleTypeDef *hrtc, uint32_t SmoothCalibPeriod,
+                                           uint32_t SmoothCalibPlusPulses, uint32_t SmoothCalibMinusPulsesValue);
+
+// ===== TIM =====
+
+typedef struct {
+    __IO uint32_t CR1;
+    __IO uint32_t DIER;
+    __IO uint32_t SR;
+    __IO uint32_t EGR;
+    __IO uint32_t CNT;
+    __IO uint32_t PSC;
+    __IO uint32_t ARR;
+} TIM_TypeDef;
+
+// Brings CNT and SR up to the virtual time on every access
+TIM_TypeDef *sim_tim2(void);
+#define TIM2 sim_tim2()
+#define TIM_CR1_CEN (1U << 0)
+#define TIM_DIER_UIE (1U << 0)
+#define TIM_SR_UIF (1U << 0)
+#define TIM_EGR_UG (1U << 0)
+
+void TIM2_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STM32F4XX_HAL_H
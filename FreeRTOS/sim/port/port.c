@@ -0,0 +1,286 @@
+/**
+ * @file port.c
+ * @brief FreeRTOS port for the host simulation (see portmacro.h).
+ *
+ * Every task gets a thread, parked on its own condition variable. A context
+ * switch wakes the thread of the task the kernel picked and parks the
+ * running one, so exactly one thread runs at any time and the kernel's data
+ * needs no locking of its own. The thread is found through the top of the
+ * task's stack, where pxPortInitialiseStack() leaves a pointer to it; the
+ * kernel keeps that pointer as the first word of the TCB.
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "sim.h"
+
+#define THREAD_STACK_BYTES (256 * 1024)
+#define MAX_THREADS 64 // kept for the report, also once deleted
+#define THREAD_WORDS (sizeof(thread_t *) / sizeof(StackType_t))
+
+typedef struct {
+    pthread_t id;
+    pthread_cond_t cond;
+    bool go;    // its turn to run
+    bool dying; // its task was deleted
+    TaskFunction_t code;
+    void *params;
+    void *stack;
+    sim_task_info_t *info;
+} thread_t;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t main_cond = PTHREAD_COND_INITIALIZER;
+static __thread thread_t *self;
+
+// State of the simulated core; only the running thread touches it
+static bool started;
+static bool masked; // BASEPRI
+static uint32_t primask;
+static bool in_isr;
+static bool yield_pending; // PendSV
+static UBaseType_t nesting;
+
+static sim_task_info_t infos[MAX_THREADS];
+static char names[MAX_THREADS][configMAX_TASK_NAME_LEN];
+static int info_count;
+static uint64_t since_us; // running task switched in
+
+// ===== THREADS =====
+
+static thread_t *task_thread(void *task) {
+    thread_t *thread;
+
+    memcpy(&thread, *(StackType_t **)task, sizeof(thread));
+    return thread;
+}
+
+// Parks the calling thread until it is its turn; false if its task is gone
+static bool wait_turn(thread_t *thread) {
+    pthread_mutex_lock(&lock);
+    while (!thread->go) {
+        pthread_cond_wait(&thread->cond, &lock);
+    }
+    thread->go = false;
+    pthread_mutex_unlock(&lock);
+    return !thread->dying;
+}
+
+static void wake(thread_t *thread) {
+    pthread_mutex_lock(&lock);
+    thread->go = true;
+    pthread_cond_signal(&thread->cond);
+    pthread_mutex_unlock(&lock);
+}
+
+static void *thread_main(void *arg) {
+    thread_t *thread = arg;
+
+    self = thread;
+    if (wait_turn(thread)) {
+        thread->code(thread->params);
+        sim_fail("task %s returned", pcTaskGetName(NULL));
+    }
+    return NULL;
+}
+
+static void *map_stack(void) {
+    void *stack = mmap(NULL, THREAD_STACK_BYTES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (stack == MAP_FAILED) {
+        sim_fail("no memory for a task stack");
+    }
+    return stack;
+}
+
+StackType_t *pxPortInitialiseStack(StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters) {
+    thread_t *thread = calloc(1, sizeof(*thread));
+    pthread_attr_t attr;
+
+    if (thread == NULL || info_count == MAX_THREADS) {
+        sim_fail("too many tasks for the simulation");
+    }
+    thread->code = pxCode;
+    thread->params = pvParameters;
+    thread->stack = map_stack();
+    thread->info = &infos[info_count++];
+    pthread_cond_init(&thread->cond, NULL);
+
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, thread->stack, THREAD_STACK_BYTES);
+    if (pthread_create(&thread->id, &attr, thread_main, thread) != 0) {
+        sim_fail("cannot start a thread");
+    }
+    pthread_attr_destroy(&attr);
+
+    pxTopOfStack -= THREAD_WORDS - 1;
+    memcpy(pxTopOfStack, &thread, sizeof(thread));
+    return pxTopOfStack;
+}
+
+void vPortCleanUpTCB(void *pxTCB) {
+    thread_t *thread = task_thread(pxTCB);
+
+    thread->dying = true;
+    wake(thread);
+    pthread_join(thread->id, NULL);
+    pthread_cond_destroy(&thread->cond);
+    munmap(thread->stack, THREAD_STACK_BYTES);
+    free(thread);
+}
+
+// ===== SCHEDULER =====
+
+static void account_switch(thread_t *next) {
+    uint64_t now = sim_now_us();
+
+    if (self != NULL) {
+        self->info->run_us += now - since_us;
+    }
+    since_us = now;
+    if (next->info->name == NULL) {
+        strncpy(names[next->info - infos], pcTaskGetName(NULL), configMAX_TASK_NAME_LEN - 1);
+        next->info->name = names[next->info - infos];
+    }
+    next->info->switches++;
+}
+
+static void context_switch(void) {
+    yield_pending = false;
+    vTaskSwitchContext();
+
+    thread_t *next = task_thread(xTaskGetCurrentTaskHandle());
+    if (next != self) {
+        account_switch(next);
+        wake(next);
+        if (!wait_turn(self)) {
+            pthread_exit(NULL);
+        }
+    }
+}
+
+BaseType_t xPortStartScheduler(void) {
+    thread_t *first = task_thread(xTaskGetCurrentTaskHandle());
+
+    started = true;
+    masked = false;
+    nesting = 0;
+    account_switch(first);
+    wake(first);
+
+    // The simulation ends with exit() from whichever task runs then
+    pthread_mutex_lock(&lock);
+    for (;;) {
+        pthread_cond_wait(&main_cond, &lock);
+    }
+    return pdFALSE;
+}
+
+void vPortEndScheduler(void) {
+    sim_finish("scheduler ended");
+}
+
+bool port_irq_enabled(void) {
+    return started && !masked && !primask && !in_isr;
+}
+
+void port_service(void) {
+    while (port_irq_enabled()) {
+        if (sim_take_due()) {
+            continue;
+        }
+        if (!yield_pending) {
+            break;
+        }
+        context_switch();
+    }
+}
+
+void port_isr(sim_isr_t isr, void *arg) {
+    in_isr = true;
+    isr(arg);
+    in_isr = false;
+}
+
+void port_tick_isr(void *arg) {
+    (void)arg;
+    if (xTaskIncrementTick() != pdFALSE) {
+        yield_pending = true;
+    }
+}
+
+void vPortYield(void) {
+    yield_pending = true;
+    port_service();
+}
+
+void vPortYieldFromISR(void) {
+    yield_pending = true;
+}
+
+// ===== INTERRUPT MASKS =====
+
+void vPortEnterCritical(void) {
+    masked = true;
+    nesting++;
+}
+
+void vPortExitCritical(void) {
+    configASSERT(nesting > 0);
+    if (--nesting == 0) {
+        vPortEnableInterrupts();
+    }
+}
+
+void vPortDisableInterrupts(void) {
+    masked = true;
+}
+
+void vPortEnableInterrupts(void) {
+    masked = false;
+    port_service();
+}
+
+UBaseType_t xPortSetInterruptMask(void) {
+    UBaseType_t was = masked;
+
+    masked = true;
+    return was;
+}
+
+void vPortClearInterruptMask(UBaseType_t mask) {
+    masked = mask != 0;
+    port_service();
+}
+
+uint32_t port_get_primask(void) {
+    return primask;
+}
+
+void port_set_primask(uint32_t value) {
+    primask = value & 1;
+    port_service();
+}
+
+// ===== REPORT =====
+
+int port_task_info(sim_task_info_t *out, int max) {
+    int n = info_count < max ? info_count : max;
+
+    // Charge the running task up to now
+    if (self != NULL) {
+        self->info->run_us += sim_now_us() - since_us;
+        since_us = sim_now_us();
+    }
+    memcpy(out, infos, n * sizeof(*out));
+    return n;
+}
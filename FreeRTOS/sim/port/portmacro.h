@@ -0,0 +1,97 @@
+/**
+ * @file portmacro.h
+ * @brief FreeRTOS port for the host simulation: one thread per task, virtual time.
+ *
+ * Modelled on the kernel's POSIX port, which is not vendored here and ticks
+ * from a wall-clock timer. This one ticks from the simulation's virtual
+ * clock (sim.c), so the apps run many times faster than real time.
+ *
+ * The simulated core has the Cortex-M4's interrupt model: BASEPRI for the
+ * kernel's critical sections, PRIMASK for the application, and a context
+ * switch that is pended like PendSV and happens once nothing masks it.
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define portCHAR char
+#define portFLOAT float
+#define portDOUBLE double
+#define portLONG long
+#define portSHORT short
+#define portSTACK_TYPE uint32_t
+#define portBASE_TYPE long
+#define portPOINTER_SIZE_TYPE uintptr_t
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#if (configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_32_BITS)
+#error The simulation port takes a 32-bit tick, as on the board.
+#endif
+typedef uint32_t TickType_t;
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define portTICK_TYPE_IS_ATOMIC 1
+
+#define portSTACK_GROWTH (-1)
+#define portTICK_PERIOD_MS ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portBYTE_ALIGNMENT 8
+#define portNOP()
+
+// ===== INTERRUPTS AND CRITICAL SECTIONS =====
+
+void vPortEnterCritical(void);
+void vPortExitCritical(void);
+void vPortDisableInterrupts(void);
+void vPortEnableInterrupts(void);
+UBaseType_t xPortSetInterruptMask(void);
+void vPortClearInterruptMask(UBaseType_t mask);
+
+#define portENTER_CRITICAL() vPortEnterCritical()
+#define portEXIT_CRITICAL() vPortExitCritical()
+#define portDISABLE_INTERRUPTS() vPortDisableInterrupts()
+#define portENABLE_INTERRUPTS() vPortEnableInterrupts()
+#define portSET_INTERRUPT_MASK_FROM_ISR() xPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x) vPortClearInterruptMask(x)
+
+// ===== SCHEDULER =====
+
+void vPortYield(void);
+void vPortYieldFromISR(void);
+
+#define portYIELD() vPortYield()
+#define portEND_SWITCHING_ISR(xSwitchRequired) \
+    do {                                       \
+        if ((xSwitchRequired) != pdFALSE) {    \
+            vPortYieldFromISR();               \
+        }                                      \
+    } while (0)
+#define portYIELD_FROM_ISR(x) portEND_SWITCHING_ISR(x)
+
+#define portTASK_FUNCTION_PROTO(vFunction, pvParameters) void vFunction(void *pvParameters)
+#define portTASK_FUNCTION(vFunction, pvParameters) void vFunction(void *pvParameters)
+
+// Joins the thread of a deleted task
+void vPortCleanUpTCB(void *pxTCB);
+#define portCLEAN_UP_TCB(pxTCB) vPortCleanUpTCB(pxTCB)
+
+// Tickless idle jumps the virtual clock to the next event (sim.c)
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime);
+#define portSUPPRESS_TICKS_AND_SLEEP(xExpectedIdleTime) vPortSuppressTicksAndSleep(xExpectedIdleTime)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PORTMACRO_H
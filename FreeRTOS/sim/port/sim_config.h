@@ -0,0 +1,35 @@
+/**
+ * @file sim_config.h
+ * @brief Kernel settings every simulated app shares; end of each app's FreeRTOSConfig.h.
+ *
+ * The app's own settings stay as on the board. The simulation adds the idle
+ * hook and tickless idle, which are how the virtual clock skips idle time,
+ * and turns a failed configASSERT() into an error message and exit code
+ * instead of a hang.
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#ifndef SIM_CONFIG_H
+#define SIM_CONFIG_H
+
+void sim_assert(const char *file, int line);
+
+#undef configUSE_IDLE_HOOK
+#define configUSE_IDLE_HOOK 1
+#undef configUSE_TICKLESS_IDLE
+#define configUSE_TICKLESS_IDLE 1
+#undef configEXPECTED_IDLE_TIME_BEFORE_SLEEP
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP 2
+
+#undef configASSERT
+#define configASSERT(x)                     \
+    do {                                    \
+        if ((x) == 0) {                     \
+            sim_assert(__FILE__, __LINE__); \
+        }                                   \
+    } while (0)
+
+#endif // SIM_CONFIG_H
@@ -0,0 +1,517 @@
+/**
+ * @file sim.c
+ * @brief Virtual clock, interrupt events, script and report of the simulation.
+ *
+ * The clock only moves forward in sim_busy_us() and while the idle task
+ * has nothing to do. Events are kept in a min-heap by time; the SysTick is
+ * not in the heap but counted alongside it, and stops while the kernel
+ * suppresses ticks, which is what lets an idle app skip ahead.
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "sim.h"
+
+#define TICK_US (1000000u / configTICK_RATE_HZ)
+#define DEFAULT_SECONDS 60
+#define LINE_LEN 512
+#define MAX_TASKS 64
+#define NONE UINT64_MAX
+
+typedef struct {
+    uint64_t at_us;
+    uint64_t seq; // keeps events at the same time in order
+    sim_isr_t isr;
+    void *arg;
+} event_t;
+
+typedef struct {
+    char key[96];
+    double value;
+} metric_t;
+
+bool sim_gpio_log;
+
+static uint64_t now_us;
+static uint64_t next_tick_us;
+static bool ticking;
+static uint64_t idle_us;
+static uint32_t sleeps;
+
+static event_t *heap;
+static size_t heap_len, heap_cap;
+static uint64_t event_seq;
+
+static FILE *out;
+static bool quiet;
+static bool at_line_start = true;
+static const char *last_channel;
+static struct timespec real_start;
+static const char *summary_path;
+static const char *baseline_path;
+static double tolerance = 10.0;
+
+static metric_t metrics[MAX_TASKS * 2 + 64];
+static int metric_count;
+
+// ===== EVENTS =====
+
+static bool earlier(const event_t *a, const event_t *b) {
+    return a->at_us < b->at_us || (a->at_us == b->at_us && a->seq < b->seq);
+}
+
+static void heap_swap(size_t a, size_t b) {
+    event_t e = heap[a];
+    heap[a] = heap[b];
+    heap[b] = e;
+}
+
+void sim_at(uint64_t at_us, sim_isr_t isr, void *arg) {
+    if (heap_len == heap_cap) {
+        heap_cap = heap_cap ? heap_cap * 2 : 64;
+        heap = realloc(heap, heap_cap * sizeof(*heap));
+        if (heap == NULL) {
+            sim_fail("no memory for events");
+        }
+    }
+    size_t i = heap_len++;
+    heap[i] = (event_t){.at_us = at_us, .seq = event_seq++, .isr = isr, .arg = arg};
+    while (i > 0 && earlier(&heap[i], &heap[(i - 1) / 2])) {
+        heap_swap(i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+static event_t heap_pop(void) {
+    event_t top = heap[0];
+
+    heap[0] = heap[--heap_len];
+    for (size_t i = 0;;) {
+        size_t least = i, l = 2 * i + 1, r = l + 1;
+        if (l < heap_len && earlier(&heap[l], &heap[least])) {
+            least = l;
+        }
+        if (r < heap_len && earlier(&heap[r], &heap[least])) {
+            least = r;
+        }
+        if (least == i) {
+            break;
+        }
+        heap_swap(i, least);
+        i = least;
+    }
+    return top;
+}
+
+static uint64_t next_event_us(void) {
+    uint64_t next = heap_len ? heap[0].at_us : NONE;
+
+    if (ticking && next_tick_us < next) {
+        next = next_tick_us;
+    }
+    return next;
+}
+
+bool sim_take_due(void) {
+    if (ticking && next_tick_us <= now_us && (heap_len == 0 || next_tick_us <= heap[0].at_us)) {
+        next_tick_us += TICK_US;
+        port_isr(port_tick_isr, NULL);
+        return true;
+    }
+    if (heap_len && heap[0].at_us <= now_us) {
+        event_t e = heap_pop();
+        port_isr(e.isr, e.arg);
+        return true;
+    }
+    return false;
+}
+
+// ===== CLOCK =====
+
+uint64_t sim_now_us(void) {
+    return now_us;
+}
+
+void sim_busy_us(uint32_t us) {
+    uint64_t left = us;
+
+    // CPU time of this task: a switch away in between does not use it up
+    for (;;) {
+        port_service();
+        if (left == 0) {
+            break;
+        }
+        uint64_t step = left;
+        if (port_irq_enabled()) {
+            uint64_t next = next_event_us();
+            if (next - now_us < step) {
+                step = next - now_us;
+            }
+        }
+        now_us += step;
+        left -= step;
+    }
+}
+
+static void idle_until(uint64_t at_us) {
+    if (at_us > now_us) {
+        idle_us += at_us - now_us;
+        sim_app_idle(at_us - now_us);
+        now_us = at_us;
+    }
+}
+
+// Every task is blocked for less than configEXPECTED_IDLE_TIME_BEFORE_SLEEP
+void vApplicationIdleHook(void) {
+    uint64_t next = next_event_us();
+
+    if (next == NONE) {
+        sim_finish("nothing left to happen");
+    }
+    idle_until(next);
+    port_service();
+}
+
+// Scheduler suspended; masked by PRIMASK, as on the board, so that the
+// critical section in vTaskStepTick() leaves it masked
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime) {
+    port_set_primask(1);
+    if (eTaskConfirmSleepModeStatus() == eAbortSleep || next_tick_us <= now_us) {
+        port_set_primask(0);
+        return;
+    }
+
+    uint64_t last_tick = next_tick_us - TICK_US;
+    uint64_t wake = last_tick + (uint64_t)xExpectedIdleTime * TICK_US;
+    if (heap_len && heap[0].at_us < wake) {
+        wake = heap[0].at_us;
+    }
+    ticking = false;
+    idle_until(wake);
+    sleeps++;
+
+    TickType_t elapsed = (TickType_t)((now_us - last_tick) / TICK_US);
+    if (elapsed > 0) {
+        vTaskStepTick(elapsed);
+    }
+    next_tick_us = last_tick + ((uint64_t)elapsed + 1) * TICK_US;
+    ticking = true;
+    port_set_primask(0);
+}
+
+void vApplicationStackOverflowHook(TaskHandle_t task, char *name) {
+    (void)task;
+    sim_fail("stack overflow in %s", name);
+}
+
+void sim_assert(const char *file, int line) {
+    sim_fail("assertion failed at %s:%d", file, line);
+}
+
+// ===== CONSOLE =====
+
+void sim_console(const char *channel, const char *text, uint32_t len) {
+    if (quiet) {
+        return;
+    }
+    // A line cut off by another channel ends there
+    if (!at_line_start && last_channel != NULL && strcmp(channel, last_channel) != 0) {
+        fputc('\n', out);
+        at_line_start = true;
+    }
+    last_channel = channel;
+    for (uint32_t i = 0; i < len; i++) {
+        if (at_line_start) {
+            fprintf(out, "[%5llu.%06llu %s] ", (unsigned long long)(now_us / 1000000),
+                    (unsigned long long)(now_us % 1000000), channel);
+            at_line_start = false;
+        }
+        if (text[i] == '\r') {
+            continue;
+        }
+        fputc(text[i], out);
+        if (text[i] == '\n') {
+            at_line_start = true;
+        }
+    }
+}
+
+// printf() of the app goes to the SWO console on the board
+static ssize_t swo_write(void *cookie, const char *buf, size_t len) {
+    (void)cookie;
+    sim_console("swo", buf, (uint32_t)len);
+    return (ssize_t)len;
+}
+
+static void console_init(void) {
+    out = fdopen(dup(STDOUT_FILENO), "w");
+    stdout = fopencookie(NULL, "w", (cookie_io_functions_t){.write = swo_write});
+    if (out == NULL || stdout == NULL) {
+        fprintf(stderr, "cannot set up the console\n");
+        exit(1);
+    }
+    setvbuf(stdout, NULL, _IOLBF, 0);
+}
+
+void sim_fail(const char *fmt, ...) {
+    va_list args;
+
+    fflush(stdout);
+    fflush(out);
+    fprintf(stderr, "[%5llu.%06llu] sim: ", (unsigned long long)(now_us / 1000000),
+            (unsigned long long)(now_us % 1000000));
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+    fputc('\n', stderr);
+    _exit(1);
+}
+
+// ===== SCRIPT =====
+
+static void end_isr(void *arg) {
+    (void)arg;
+    sim_finish("end of script");
+}
+
+static void unescape(char *s) {
+    char *d = s;
+
+    for (; *s; s++) {
+        if (*s != '\\' || s[1] == '\0') {
+            *d++ = *s;
+            continue;
+        }
+        switch (*++s) {
+        case 'n': *d++ = '\n'; break;
+        case 'r': *d++ = '\r'; break;
+        case 't': *d++ = '\t'; break;
+        default: *d++ = *s; break;
+        }
+    }
+    *d = '\0';
+}
+
+static bool load_script(const char *path, double seconds) {
+    FILE *f = fopen(path, "r");
+    char line[LINE_LEN];
+    bool has_end = false;
+    int n = 0;
+
+    if (f == NULL) {
+        perror(path);
+        return false;
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+        n++;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        char *p = line + strspn(line, " \t");
+        if (*p == '\0' || *p == '#') {
+            continue;
+        }
+        char *end;
+        double at = strtod(p, &end);
+        char cmd[32];
+        int used = 0;
+        if (end == p || at < 0 || sscanf(end, " %31s %n", cmd, &used) != 1) {
+            fprintf(stderr, "%s:%d: expected \"<seconds> <command> [args]\"\n", path, n);
+            fclose(f);
+            return false;
+        }
+        char *args = end + used;
+        uint64_t at_us = (uint64_t)llround(at * 1e6);
+
+        unescape(args);
+        if (strcmp(cmd, "end") == 0) {
+            sim_at(at_us, end_isr, NULL);
+            has_end = true;
+        } else if (!sim_hal_command(at_us, cmd, args)) {
+            fprintf(stderr, "%s:%d: unknown command or bad arguments: %s %s\n", path, n, cmd, args);
+            fclose(f);
+            return false;
+        }
+    }
+    fclose(f);
+    if (!has_end) {
+        sim_at((uint64_t)llround(seconds * 1e6), end_isr, NULL);
+    }
+    return true;
+}
+
+// ===== REPORT =====
+
+// Apps without metrics of their own leave it out
+__attribute__((weak)) void sim_app_report(void (*metric)(const char *key, double value)) {
+    (void)metric;
+}
+
+static void metric(const char *key, double value) {
+    if (metric_count == (int)(sizeof(metrics) / sizeof(metrics[0]))) {
+        return;
+    }
+    metric_t *m = &metrics[metric_count++];
+    snprintf(m->key, sizeof(m->key), "%s", key);
+    for (char *c = m->key; *c; c++) {
+        if (*c == ' ') {
+            *c = '_';
+        }
+    }
+    m->value = value;
+}
+
+static void report(void) {
+    struct timespec real_end;
+    sim_task_info_t tasks[MAX_TASKS];
+    int n = port_task_info(tasks, MAX_TASKS);
+    uint32_t switches = 0;
+    char key[96];
+
+    clock_gettime(CLOCK_MONOTONIC, &real_end);
+    double real_s = (double)(real_end.tv_sec - real_start.tv_sec) + (real_end.tv_nsec - real_start.tv_nsec) / 1e9;
+    double sim_s = now_us / 1e6;
+
+    for (int i = 0; i < n; i++) {
+        switches += tasks[i].switches;
+    }
+    fprintf(out, "\nSimulated %.3f s in %.3f s (%.0fx real time), %u context switches, %u tickless sleeps\n", sim_s,
+            real_s, real_s > 0 ? sim_s / real_s : 0.0, (unsigned)switches, (unsigned)sleeps);
+    fprintf(out, "  %-16s %9s %14s %7s\n", "task", "switches", "run us", "cpu %");
+    for (int i = 0; i < n; i++) {
+        const char *name = tasks[i].name ? tasks[i].name : "(never ran)";
+        fprintf(out, "  %-16s %9u %14llu %6.2f%%\n", name, (unsigned)tasks[i].switches,
+                (unsigned long long)tasks[i].run_us, now_us ? 100.0 * tasks[i].run_us / now_us : 0.0);
+        snprintf(key, sizeof(key), "task.%s.switches", name);
+        metric(key, tasks[i].switches);
+        snprintf(key, sizeof(key), "task.%s.run_us", name);
+        metric(key, (double)tasks[i].run_us);
+    }
+    fprintf(out, "  idle %.2f%% of the time\n", now_us ? 100.0 * idle_us / now_us : 0.0);
+
+    metric("sim_seconds", sim_s);
+    metric("context_switches", switches);
+    metric("idle_us", (double)idle_us);
+    sim_hal_report(metric);
+    sim_app_report(metric);
+}
+
+static bool write_summary(const char *path) {
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        perror(path);
+        return false;
+    }
+    for (int i = 0; i < metric_count; i++) {
+        fprintf(f, "%s %.3f\n", metrics[i].key, metrics[i].value);
+    }
+    fclose(f);
+    return true;
+}
+
+// Returns the number of metrics outside the tolerance, or -1 on error.
+static int compare_summary(const char *path, double tolerance_pct) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    char key[96];
+    double expected;
+    int failures = 0;
+    fprintf(out, "\nAgainst %s (tolerance %.1f%%)\n", path, tolerance_pct);
+    while (fscanf(f, "%95s %lf", key, &expected) == 2) {
+        const metric_t *m = NULL;
+        for (int i = 0; i < metric_count; i++) {
+            if (strcmp(metrics[i].key, key) == 0) {
+                m = &metrics[i];
+                break;
+            }
+        }
+        if (m == NULL) {
+            fprintf(out, "  MISSING %s\n", key);
+            failures++;
+            continue;
+        }
+        double diff = fabs(m->value - expected);
+        double limit = fabs(expected) * tolerance_pct / 100.0;
+        bool exact = strstr(key, "_hash") != NULL;
+        if (exact ? diff != 0 : (diff > limit && diff >= 1.0)) { // ignore sub-unit jitter on small values
+            fprintf(out, "  DRIFT   %s %.3f -> %.3f\n", key, expected, m->value);
+            failures++;
+        }
+    }
+    fclose(f);
+    fprintf(out, "  %d of the baseline metrics drifted\n", failures);
+    return failures;
+}
+
+void sim_finish(const char *why) {
+    int status = 0;
+
+    fflush(stdout);
+    if (!at_line_start && !quiet) {
+        fputc('\n', out);
+    }
+    fprintf(out, "\nStopped: %s\n", why);
+    report();
+    if (summary_path != NULL && !write_summary(summary_path)) {
+        status = 1;
+    }
+    if (baseline_path != NULL) {
+        int failures = compare_summary(baseline_path, tolerance);
+        if (failures != 0) {
+            status = failures < 0 ? 1 : 2;
+        }
+    }
+    fflush(out);
+    _exit(status);
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s [-d seconds] [-q] [-g] [-o summary.txt] [-r baseline.txt] [-t tolerance_pct] script.txt\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    double seconds = DEFAULT_SECONDS;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "d:qgo:r:t:")) != -1) {
+        switch (opt) {
+        case 'd': seconds = atof(optarg); break;
+        case 'q': quiet = true; break;
+        case 'g': sim_gpio_log = true; break;
+        case 'o': summary_path = optarg; break;
+        case 'r': baseline_path = optarg; break;
+        case 't': tolerance = atof(optarg); break;
+        default: usage(argv[0]); return 1;
+        }
+    }
+    if (optind != argc - 1 || tolerance < 0 || seconds <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    console_init();
+    if (!load_script(argv[optind], seconds)) {
+        return 1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &real_start);
+
+    ticking = true;
+    next_tick_us = TICK_US;
+    sim_app_start();
+    sim_fail("the scheduler did not start");
+}
@@ -0,0 +1,126 @@
+/**
+ * @file sim.h
+ * @brief Host simulation of the STM32F446 FreeRTOS apps in virtual time.
+ *
+ * It also runs the ESP32 hotel (esp32_codes/016_Hotel_system_FreeRTOS),
+ * whose tasks only use the kernel, as sim_016; the printf of its tasks
+ * is the swo output below.
+ *
+ * The application tasks and the vendored kernel are built for the host.
+ * Each task runs on its own thread, but only one runs at a time, the one
+ * the kernel picked (port/port.c). Time is virtual: it only moves when the
+ * code spends it, in HAL calls that busy-wait on the target (UART transmit,
+ * HAL_Delay) and when every task is blocked, where it jumps straight to the
+ * next event. A minute of a mostly idle app takes milliseconds.
+ *
+ * Events are the interrupts of the board: the SysTick, bytes arriving on
+ * USART2, and the script, a text file of timed inputs:
+ *
+ *   # seconds  command
+ *   0.5   uart 1\n          bytes into USART2 at the configured baud rate
+ *   2.0   gpio C13 0        level of an input pin (inputs idle high)
+ *   3.0   rtc_ppm 35        error of the RTC clock, in ppm
+ *   60    end               stop and report (default: -d seconds)
+ *
+ * Text after "uart " is sent as is, with \n, \r, \t and \\ escapes.
+ *
+ *   sim_<app> [-d seconds] [-q] [-g] [-o summary.txt] [-r baseline.txt]
+ *             [-t tolerance_pct] script.txt
+ *
+ *   -d   stop after this many simulated seconds without an end command
+ *   -q   do not echo UART and printf output
+ *   -g   log every change of a GPIO output
+ *   -o   write the metrics as "key value" lines
+ *   -r   compare the metrics with a summary written by -o and exit with 2
+ *        when one drifts by more than -t percent (default 10), or when the
+ *        UART output differs (uart.tx_hash), so task interactions can be
+ *        regression-tested
+ *
+ * UART output is printed as "[seconds uart] text", printf output (the SWO
+ * console on the board) as "[seconds swo] text". A task that spins
+ * without calling the HAL or the kernel stops the virtual clock, and the
+ * stack figures of the kernel mean nothing here: tasks run on host stacks.
+ *
+ * @author Rahul B.
+ * @version 1.0
+ * @date October 2026
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef void (*sim_isr_t)(void *arg);
+
+// ===== CLOCK AND EVENTS =====
+
+// Virtual microseconds since reset.
+uint64_t sim_now_us(void);
+
+// Spends us of CPU time in the running task; interrupts are taken on the way.
+void sim_busy_us(uint32_t us);
+
+// Runs isr as an interrupt at at_us (at once if that has passed).
+void sim_at(uint64_t at_us, sim_isr_t isr, void *arg);
+
+// Runs the earliest interrupt that is due, if any (for the port).
+bool sim_take_due(void);
+
+// Ends the run: report, summary, exit code.
+void sim_finish(const char *why);
+
+// Fatal error in the application or the sim.
+void sim_fail(const char *fmt, ...);
+
+// Host stream for the console lines and the report.
+void sim_console(const char *channel, const char *text, uint32_t len);
+extern bool sim_gpio_log;
+
+// ===== APPLICATION (apps/<app>/board.c) =====
+
+// Does what main() does on the board after the HAL init; does not return.
+void sim_app_start(void);
+
+// Called for every stretch of idle time, e.g. for the app's power account.
+void sim_app_idle(uint64_t idle_us);
+
+// Adds the app's own metrics to the report and the summary (optional).
+void sim_app_report(void (*metric)(const char *key, double value));
+
+// ===== HAL SHIM (hal/sim_hal.c) =====
+
+// Applies one script command other than "end"; false if it is unknown.
+bool sim_hal_command(uint64_t at_us, const char *cmd, const char *args);
+
+// Adds the HAL's metrics to the report and the summary.
+void sim_hal_report(void (*metric)(const char *key, double value));
+
+// ===== PORT (port/port.c) =====
+
+// Interrupts can be taken now: scheduler running, nothing masked, not in an ISR.
+bool port_irq_enabled(void);
+
+// Takes the interrupts that are due and the context switches they ask for.
+void port_service(void);
+
+// PRIMASK, for __disable_irq() and friends.
+uint32_t port_get_primask(void);
+void port_set_primask(uint32_t primask);
+
+// Per-task figures for the report, including deleted tasks.
+typedef struct {
+    const char *name;
+    uint64_t run_us;
+    uint32_t switches;
+} sim_task_info_t;
+int port_task_info(sim_task_info_t *out, int max);
+
+// Runs isr in interrupt context.
+void port_isr(sim_isr_t isr, void *arg);
+
+// SysTick handler.
+void port_tick_isr(void *arg);
+
+#endif // SIM_H